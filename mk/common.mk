@@ -7,7 +7,7 @@ override TGT = $(eval \
 override A_TGT = $(eval override A_TGT:=$$(filter %.a,$$(TGT)))$(A_TGT)
 override O_TGT = $(eval override O_TGT:=$$(strip $$(TGT:%.a=)))$(O_TGT)
 
-.PHONY: all $(TGT)             \
+.PHONY: all $(TGT) bench       \
         compile_commands.json  \
         clean $(TGT:%=clean-%) \
         purge $(TGT:%=purge-%) \
@@ -34,9 +34,6 @@ endif
 ifeq (,$(filter -O -O%,$(CFLAGS)))
 override CFLAGS += -O3
 endif
-ifeq (,$(filter -mcpu=% -march=% -mtune=%,$(CFLAGS)))
-override CFLAGS += -march=native -mtune=native
-endif
 
 ifeq (,$(filter -flto=% -flto -fno-lto,$(CXXFLAGS)))
 override CXXFLAGS += -flto=auto
@@ -44,9 +41,6 @@ endif
 ifeq (,$(filter -O -O%,$(CXXFLAGS)))
 override CXXFLAGS += -O3
 endif
-ifeq (,$(filter -mcpu=% -march=% -mtune=%,$(CXXFLAGS)))
-override CXXFLAGS += -march=native -mtune=native
-endif
 
 override _cc_var = $(shell $(wordlist 2,$(words $1),$1))
 override __cc_var = $(call _cc_var,$(foreach x,$1, || { command -v "$x" >/dev/null && echo "$x"; } ))
@@ -155,6 +149,12 @@ $(call targets,$(TGT))
 compile_commands.json: | $Ocompile_commands.json
 $Ocompile_commands.json: $(JSON); jq -s '.' $^ > "$@"
 
+# Run each benchmark in $(BENCH), once per environment assignment
+# in $(BENCH_ENV) if there are any.
+bench: | $(BENCH:%=$O%)
+	$(foreach b,$(BENCH:%=$O%),$(if $(BENCH_ENV),$(foreach e,$(BENCH_ENV),\
+	  $e "$b" $(BENCHFLAGS) &&),"$b" $(BENCHFLAGS) &&)) :
+
 purge: | clean clean.d clean-compile_commands.json
 clean: | clean.o clean.json
 
@@ -0,0 +1,807 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file bench-utf8.c
+ *
+ * @brief Throughput benchmarks for the UTF-8 engines.
+ *
+ * Generates reproducible corpora in memory, runs every engine over
+ * each of them in buffers of several sizes, and prints the best of
+ * a few trials in GB/s and in cycles per byte. The vector kernel is
+ * picked as usual, so `make bench` runs the program once per value
+ * of the `UTF8_KERNEL` environment variable.
+ *
+ * Arguments, if any, are corpus and engine names, and limit the run
+ * to those.
+ *
+ * @author Juuso Alasuutari
+ */
+#define _GNU_SOURCE // memmem(), wcwidth()
+
+#include <errno.h>
+#include <iconv.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <wchar.h>
+
+#if defined __x86_64__ || defined __i386__
+# include <x86intrin.h>
+# define bench_cycles() __rdtsc()
+#else
+# define bench_cycles() UINT64_C(0)
+#endif
+
+#include "utf8.h"
+
+/** Benchmark parameters */
+enum {
+	BENCH_CORPUS_SIZE = 1 << 20, //!< Bytes per corpus
+	BENCH_TRIALS      = 5,       //!< Trials per measurement, best kept
+	BENCH_TRIAL_NS    = 20000000 //!< Least duration of one trial
+};
+
+/** Buffer sizes the corpora are cut into */
+static size_t const bench_sizes[] = {64U, 4096U, BENCH_CORPUS_SIZE};
+
+/**
+ * @brief Corpus descriptor.
+ *
+ * The columns are the name, the code point generator, and how rarely
+ * a byte is replaced with a random non-ASCII byte afterwards, 0 for
+ * never.
+ */
+#define BENCH_CORPUS_DESCRIPTOR(F) \
+        F(ascii,   cp_ascii,      0) \
+        F(latin1,  cp_latin1,     0) \
+        F(cjk,     cp_cjk,        0) \
+        F(emoji,   cp_emoji,      0) \
+        F(web,     cp_web,        0) \
+        F(bad-1e4, cp_web,    10000) \
+        F(bad-1e2, cp_web,      100) \
+        F(bad-1e1, cp_web,       10)
+
+/**
+ * @brief Engine descriptor.
+ *
+ * The columns are the name, the function, and whether the engine
+ * recovers from invalid input. An engine which doesn't only runs
+ * on the valid corpora, because it would stop at the first error.
+ */
+#define BENCH_ENGINE_DESCRIPTOR(F) \
+        F(next,     run_next,     true ) \
+        F(prev,     run_prev,     true ) \
+        F(decode,   run_decode,   true ) \
+        F(span,     run_span,     true ) \
+        F(dfa,      run_dfa,      true ) \
+        F(dfa2,     run_dfa2,     true ) \
+        F(goto,     run_goto,     true ) \
+        F(validate, run_validate, false) \
+        F(count,    run_count,    true ) \
+        F(check,    run_check,    true ) \
+        F(strings,  run_strings,  true ) \
+        F(batch,    run_batch,    true ) \
+        F(utf32,    run_utf32,    true ) \
+        F(utf16,    run_utf16,    true ) \
+        F(sanitize, run_sanitize, true ) \
+        F(width,    run_width,    false) \
+        F(nfc,      run_nfc,      false) \
+        F(find,     run_find,     true ) \
+        F(index,    run_index,    true ) \
+        F(mbrtowc,  run_mbrtowc,  true ) \
+        F(wcwidth,  run_wcwidth,  true ) \
+        F(memmem,   run_memmem,   true ) \
+        F(iconv,    run_iconv,    true )
+
+/** Output space for the converting engines */
+static uint8_t bench_out[4U * BENCH_CORPUS_SIZE];
+
+/** Keeps engine results alive */
+static volatile size_t bench_sink;
+
+/** glibc UTF-8 to UTF-32 converter, or `(iconv_t)-1` */
+static iconv_t bench_iconv = (iconv_t)-1;
+
+/** Whether `mbrtowc()` decodes UTF-8 */
+static bool bench_mbrtowc;
+
+/**
+ * @brief SplitMix64, so that the corpora don't depend on the libc.
+ */
+static uint32_t
+rnd (uint64_t *const s)
+{
+	uint64_t z = (*s += UINT64_C(0x9e3779b97f4a7c15));
+	z = (z ^ (z >> 30U)) * UINT64_C(0xbf58476d1ce4e5b9);
+	z = (z ^ (z >> 27U)) * UINT64_C(0x94d049bb133111eb);
+	return (uint32_t)((z ^ (z >> 31U)) >> 32U);
+}
+
+/** @brief Lowercase ASCII text. */
+static uint32_t
+cp_ascii (uint64_t *const s)
+{
+	uint32_t r = rnd(s) % 100U;
+	return r < 15U ? ' ' : r < 17U ? '\n' : 'a' + rnd(s) % 26U;
+}
+
+/** @brief Western European text, every third letter accented. */
+static uint32_t
+cp_latin1 (uint64_t *const s)
+{
+	uint32_t r = rnd(s) % 100U;
+	return r < 15U ? ' ' : r < 43U ? 0xc0U + rnd(s) % 64U
+	                               : 'a' + rnd(s) % 26U;
+}
+
+/** @brief CJK ideographs with some ASCII punctuation. */
+static uint32_t
+cp_cjk (uint64_t *const s)
+{
+	uint32_t r = rnd(s) % 100U;
+	return r < 8U ? ' ' : r < 10U ? '.' : 0x4e00U + rnd(s) % 0x5200U;
+}
+
+/** @brief Emoji with ASCII spaces and letters in between. */
+static uint32_t
+cp_emoji (uint64_t *const s)
+{
+	uint32_t r = rnd(s) % 100U;
+	return r < 20U ? ' ' : r < 30U ? 'a' + rnd(s) % 26U
+	                               : 0x1f300U + rnd(s) % 0x700U;
+}
+
+/** @brief Markup-heavy text with a bit of every sequence length. */
+static uint32_t
+cp_web (uint64_t *const s)
+{
+	static char const markup[] = "<>=\"/#:;.-";
+	uint32_t r = rnd(s) % 100U;
+	return r < 50U ? 'a' + rnd(s) % 26U
+	     : r < 60U ? (uint32_t)markup[rnd(s) % (sizeof markup - 1U)]
+	     : r < 70U ? ' '
+	     : r < 82U ? 0x410U + rnd(s) % 64U
+	     : r < 92U ? 0x4e00U + rnd(s) % 0x5200U
+	     : r < 96U ? 0xc0U + rnd(s) % 64U
+	     :           0x1f300U + rnd(s) % 0x700U;
+}
+
+/**
+ * @brief Fill `buf` with UTF-8 from `gen`, then corrupt one in
+ *        `corrupt` bytes on average.
+ */
+static void
+corpus_fill (uint8_t  *const buf,
+             uint32_t       (*gen)(uint64_t *),
+             unsigned        corrupt)
+{
+	uint64_t s = UINT64_C(0x5eed);
+	size_t n = 0;
+
+	while (BENCH_CORPUS_SIZE - n >= 4U) {
+		uint32_t cp = gen(&s);
+		n += utf32_to_utf8(&buf[n], &cp, 1U, utf8_stop).out;
+	}
+
+	(void)memset(&buf[n], ' ', BENCH_CORPUS_SIZE - n);
+
+	if (corrupt)
+		for (size_t i = 0; i < BENCH_CORPUS_SIZE; ++i)
+			if (!(rnd(&s) % corrupt))
+				buf[i] = (uint8_t)(0x80U | rnd(&s));
+}
+
+/** @brief Per code point parsing, the way `test-utf8` used to print. */
+static size_t
+run_next (uint8_t const *p,
+          size_t         n)
+{
+	uint8_t const *const end = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (p < end) {
+		uint8_t const *q = p;
+		p = end - q >= 4 ? utf8_parse_next_code_point(&u8p, q)
+		                 : utf8_parse_span(&u8p, q, q + 1).ptr;
+
+		if (u8p.error) {
+			if (p == q && utf8_expects_leading_byte(&u8p))
+				++p;
+			utf8_reset(&u8p);
+			continue;
+		}
+
+		count += utf8_expects_leading_byte(&u8p);
+	}
+
+	return count;
+}
+
+/** @brief Per code point parsing backwards from the end. */
+static size_t
+run_prev (uint8_t const *p,
+          size_t         n)
+{
+	uint8_t const *q = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (q > p) {
+		uint8_t const *r = utf8_parse_prev_code_point(&u8p, p, q);
+		if (u8p.error) {
+			q = utf8_prev_boundary(p, q - 1);
+			continue;
+		}
+
+		q = r;
+		++count;
+	}
+
+	return count;
+}
+
+/** @brief Per code point decoding by value. */
+static size_t
+run_decode (uint8_t const *p,
+            size_t         n)
+{
+	uint8_t const *const end = p + n;
+	size_t count = 0;
+
+	while (p < end) {
+		struct utf8_decoded d = utf8_decode_next(p, end);
+		count += d.status == utf8_decode_ok;
+		p += d.len;
+	}
+
+	return count;
+}
+
+/** @brief The state machine over whole spans. */
+static size_t
+run_span (uint8_t const *p,
+          size_t         n)
+{
+	uint8_t const *const end = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (p < end) {
+		struct utf8_span s = utf8_parse_span(&u8p, p, end);
+		count += s.count;
+		p = s.ptr;
+
+		if (u8p.error) {
+			if (utf8_expects_leading_byte(&u8p))
+				++p;
+			utf8_reset(&u8p);
+		}
+	}
+
+	return count;
+}
+
+/** @brief The shift DFA over whole spans. */
+static size_t
+run_dfa (uint8_t const *p,
+         size_t         n)
+{
+	uint8_t const *const end = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (p < end) {
+		struct utf8_span s = utf8_parse_span_dfa(&u8p, p, end);
+		count += s.count;
+		p = s.ptr;
+
+		if (u8p.error) {
+			if (utf8_expects_leading_byte(&u8p))
+				++p;
+			utf8_reset(&u8p);
+		}
+	}
+
+	return count;
+}
+
+/** @brief The two-byte stride DFA over whole spans. */
+static size_t
+run_dfa2 (uint8_t const *p,
+         size_t         n)
+{
+	uint8_t const *const end = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (p < end) {
+		struct utf8_span s = utf8_parse_span_dfa2(&u8p, p, end);
+		count += s.count;
+		p = s.ptr;
+
+		if (u8p.error) {
+			if (utf8_expects_leading_byte(&u8p))
+				++p;
+			utf8_reset(&u8p);
+		}
+	}
+
+	return count;
+}
+
+/** @brief The direct-threaded parser over whole spans. */
+static size_t
+run_goto (uint8_t const *p,
+         size_t         n)
+{
+	uint8_t const *const end = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (p < end) {
+		struct utf8_span s = utf8_parse_span_goto(&u8p, p, end);
+		count += s.count;
+		p = s.ptr;
+
+		if (u8p.error) {
+			if (utf8_expects_leading_byte(&u8p))
+				++p;
+			utf8_reset(&u8p);
+		}
+	}
+
+	return count;
+}
+
+/** @brief Bulk validation; stops at the first error. */
+static size_t
+run_validate (uint8_t const *p,
+              size_t         n)
+{
+	return utf8_validate(p, n);
+}
+
+/** @brief Bulk validation and counting in one pass. */
+static size_t
+run_count (uint8_t const *p,
+           size_t         n)
+{
+	uint8_t const *const end = p + n;
+	struct utf8 u8p = utf8();
+	size_t count = 0;
+
+	while (p < end) {
+		struct utf8_span s = utf8_validate_count(&u8p, p,
+		                                         (size_t)(end - p));
+		count += s.count;
+		p = s.ptr;
+
+		if (u8p.error) {
+			if (utf8_expects_leading_byte(&u8p))
+				++p;
+			utf8_reset(&u8p);
+		}
+	}
+
+	return count;
+}
+
+/** @brief Bulk validation with error classification. */
+static size_t
+run_check (uint8_t const *p,
+           size_t         n)
+{
+	uint8_t const *const end = p + n;
+	size_t errors = 0;
+
+	while (p < end) {
+		struct utf8_check c = utf8_check(p, (size_t)(end - p));
+		if (c.error == utf8_valid)
+			break;
+		++errors;
+		p += c.offset + 1U;
+	}
+
+	return errors;
+}
+
+/** Most strings a buffer is split into, see split() */
+#define BENCH_STRINGS_MAX (BENCH_CORPUS_SIZE / 8)
+
+/** Strings for the batch engines */
+static uint8_t const *bench_str_ptr[BENCH_STRINGS_MAX];
+static size_t bench_str_len[BENCH_STRINGS_MAX];
+static struct utf8_check bench_str_res[BENCH_STRINGS_MAX];
+
+/**
+ * @brief Split a buffer into strings of 10 to 200 bytes, each ending
+ *        at a sequence boundary unless none is near.
+ *
+ * @return The number of strings.
+ */
+static size_t
+split (uint8_t const *p,
+       size_t         n)
+{
+	uint64_t seed = n;
+	size_t k = 0;
+
+	for (size_t off = 0; off < n; ++k) {
+		size_t len = n - off, want = 10U + rnd(&seed) % 191U;
+		if (len > want) {
+			len = want;
+			for (size_t j = 0; j < 3U && len > 1U
+			     && (p[off + len] & 0xc0U) == 0x80U; ++j)
+				--len;
+		}
+		bench_str_ptr[k] = &p[off];
+		bench_str_len[k] = len;
+		off += len;
+	}
+
+	return k;
+}
+
+/** @brief Short strings checked one at a time. */
+static size_t
+run_strings (uint8_t const *p,
+             size_t         n)
+{
+	size_t k = split(p, n), valid = 0;
+
+	for (size_t i = 0; i < k; ++i)
+		valid += utf8_check(bench_str_ptr[i], bench_str_len[i]).error
+		         == utf8_valid;
+
+	return valid;
+}
+
+/** @brief Short strings checked as a batch. */
+static size_t
+run_batch (uint8_t const *p,
+           size_t         n)
+{
+	size_t k = split(p, n);
+
+	return utf8_validate_batch(bench_str_ptr, bench_str_len, k,
+	                           bench_str_res);
+}
+
+/** @brief Decoding to UTF-32, with U+FFFD for invalid input. */
+static size_t
+run_utf32 (uint8_t const *p,
+           size_t         n)
+{
+	return utf8_to_utf32((uint32_t *)bench_out, p, n, utf8_replace).out;
+}
+
+/** @brief Decoding to UTF-16, with U+FFFD for invalid input. */
+static size_t
+run_utf16 (uint8_t const *p,
+           size_t         n)
+{
+	return utf8_to_utf16le((uint16_t *)bench_out, p, n,
+	                       utf8_replace).out;
+}
+
+/** @brief Copying with U+FFFD for invalid input. */
+static size_t
+run_sanitize (uint8_t const *p,
+              size_t         n)
+{
+	return utf8_sanitize(bench_out, sizeof bench_out, p, n, 0U).out;
+}
+
+/** @brief Terminal display width. */
+static size_t
+run_width (uint8_t const *p,
+           size_t         n)
+{
+	return utf8_display_width(p, n).width;
+}
+
+/** @brief NFC quick check with validation. */
+static size_t
+run_nfc (uint8_t const *p,
+         size_t         n)
+{
+	return utf8_nfc_quick_check(p, n).offset;
+}
+
+/** @brief Search for U+2028 LINE SEPARATOR, which the corpora lack. */
+static size_t
+run_find (uint8_t const *p,
+          size_t         n)
+{
+	uint8_t const *q = utf8_find_code_point(p, n, 0x2028U);
+	return q ? (size_t)(q - p) : n;
+}
+
+/** @brief Building a code point offset index of every 64th code
+ *         point. */
+static size_t
+run_index (uint8_t const *p,
+           size_t         n)
+{
+	struct utf8_index idx;
+	if (utf8_index_build(&idx, p, n, 64U))
+		return 0;
+
+	size_t count = idx.count;
+	utf8_index_free(&idx);
+	return count;
+}
+
+/** @brief glibc baseline: `mbrtowc()` in a UTF-8 locale. */
+static size_t
+run_mbrtowc (uint8_t const *p,
+             size_t         n)
+{
+	uint8_t const *const end = p + n;
+	mbstate_t st = {0};
+	size_t count = 0;
+	wchar_t wc;
+
+	while (p < end) {
+		size_t r = mbrtowc(&wc, (char const *)p, (size_t)(end - p), &st);
+		if (r == (size_t)-2)
+			break;
+		if (r == (size_t)-1) {
+			st = (mbstate_t){0};
+			r = 1U;
+		}
+		p += r ? r : 1U;
+		++count;
+	}
+
+	return count;
+}
+
+/** @brief glibc baseline: `wcwidth()` of each `mbrtowc()` result. */
+static size_t
+run_wcwidth (uint8_t const *p,
+             size_t         n)
+{
+	uint8_t const *const end = p + n;
+	mbstate_t st = {0};
+	size_t width = 0;
+	wchar_t wc;
+
+	while (p < end) {
+		size_t r = mbrtowc(&wc, (char const *)p, (size_t)(end - p), &st);
+		if (r == (size_t)-2)
+			break;
+		if (r == (size_t)-1) {
+			st = (mbstate_t){0};
+			p += 1U;
+			continue;
+		}
+		int w = wcwidth(wc);
+		width += w > 0 ? (size_t)w : 0U;
+		p += r ? r : 1U;
+	}
+
+	return width;
+}
+
+/** @brief glibc baseline: `memmem()` for U+2028 LINE SEPARATOR. */
+static size_t
+run_memmem (uint8_t const *p,
+            size_t         n)
+{
+	uint8_t const *q = memmem(p, n, "\u2028", 3U);
+	return q ? (size_t)(q - p) : n;
+}
+
+/** @brief glibc baseline: `iconv()` to UTF-32. */
+static size_t
+run_iconv (uint8_t const *p,
+           size_t         n)
+{
+	char *in = (char *)p, *out = (char *)bench_out;
+	size_t in_left = n, out_left = sizeof bench_out;
+
+	(void)iconv(bench_iconv, nullptr, nullptr, nullptr, nullptr);
+	while (iconv(bench_iconv, &in, &in_left, &out, &out_left) == (size_t)-1
+	       && errno == EILSEQ) {
+		++in;
+		--in_left;
+	}
+
+	return sizeof bench_out - out_left;
+}
+
+/** A piece of a corpus */
+struct piece {
+	uint8_t const *ptr;
+	size_t         len;
+};
+
+/**
+ * @brief Cut a corpus into pieces of at most `size` bytes, each
+ *        ending at a sequence boundary unless none is near.
+ *
+ * @return The number of pieces.
+ */
+static size_t
+cut (struct piece  *const pieces,
+     uint8_t const *const buf,
+     size_t               size)
+{
+	size_t n = 0;
+
+	for (size_t off = 0; off < BENCH_CORPUS_SIZE; ++n) {
+		size_t len = BENCH_CORPUS_SIZE - off;
+		if (len > size) {
+			len = size;
+			for (size_t k = 0; k < 3U && len > 1U
+			     && (buf[off + len] & 0xc0U) == 0x80U; ++k)
+				--len;
+		}
+		pieces[n] = (struct piece){&buf[off], len};
+		off += len;
+	}
+
+	return n;
+}
+
+static uint64_t
+now_ns (void)
+{
+	struct timespec t;
+	(void)clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * UINT64_C(1000000000) + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief Time an engine over all pieces and print the best trial.
+ */
+static void
+measure (char const          *corpus,
+         size_t               size,
+         char const          *engine,
+         size_t             (*run)(uint8_t const *, size_t),
+         struct piece const  *pieces,
+         size_t               n)
+{
+	uint64_t best_ns = UINT64_MAX, best_cyc = 0;
+	size_t reps = 1U;
+
+	for (int trial = -1; trial < BENCH_TRIALS; ++trial) {
+		uint64_t t = now_ns(), c = bench_cycles();
+		for (size_t r = 0; r < reps; ++r)
+			for (size_t i = 0; i < n; ++i)
+				bench_sink += run(pieces[i].ptr, pieces[i].len);
+		c = bench_cycles() - c;
+		t = now_ns() - t;
+
+		if (trial < 0) {
+			// Warm-up round, also sizes the trials
+			reps = t ? (size_t)(BENCH_TRIAL_NS / t) + 1U : 1U;
+			continue;
+		}
+
+		if (t / reps < best_ns) {
+			best_ns = t / reps;
+			best_cyc = c / reps;
+		}
+	}
+
+	if (!best_ns)
+		best_ns = 1U;
+
+	double const bytes = BENCH_CORPUS_SIZE;
+	(void)printf("%-8s %8zu  %-8s %8.3f %8.3f\n", corpus, size, engine,
+	             bytes / (double)best_ns, (double)best_cyc / bytes);
+}
+
+/**
+ * @brief Check if a name was picked on the command line.
+ */
+static bool
+picked (int                c,
+        char       *const *v,
+        char const        *name,
+        char const *const *names,
+        size_t             n_names)
+{
+	bool any = false;
+
+	for (int i = 1; i < c; ++i) {
+		for (size_t k = 0; k < n_names; ++k) {
+			if (!strcmp(v[i], names[k])) {
+				if (names[k] == name)
+					return true;
+				any = true;
+			}
+		}
+	}
+
+	return !any;
+}
+
+int
+main (int    c,
+      char **v)
+{
+	//! @cond
+	#define F(n, g, k) #n,
+	//! @endcond
+	static char const *const corpus_name[] = {BENCH_CORPUS_DESCRIPTOR(F)};
+	static char const *const engine_name[] = {BENCH_ENGINE_DESCRIPTOR(F)};
+	//! @cond
+	#undef F
+	#define F(n, g, k) g,
+	//! @endcond
+	static uint32_t (*const corpus_gen[])(uint64_t *) = {BENCH_CORPUS_DESCRIPTOR(F)};
+	static size_t (*const engine_run[])(uint8_t const *, size_t) = {BENCH_ENGINE_DESCRIPTOR(F)};
+	//! @cond
+	#undef F
+	#define F(n, g, k) k,
+	//! @endcond
+	static unsigned const corpus_corrupt[] = {BENCH_CORPUS_DESCRIPTOR(F)};
+	static bool const engine_recovers[] = {BENCH_ENGINE_DESCRIPTOR(F)};
+	//! @cond
+	#undef F
+	//! @endcond
+
+	size_t const n_corpora = sizeof corpus_name / sizeof *corpus_name;
+	size_t const n_engines = sizeof engine_name / sizeof *engine_name;
+
+	// The kernel can only be picked once per process, and the level
+	// asked for isn't used if the CPU can't run it
+	char const *env = getenv("UTF8_KERNEL");
+	if (env && strcmp(env, utf8_kernel())) {
+		(void)fprintf(stderr, "%s: kernel %s not available, skipping\n",
+		              v[0], env);
+		return EXIT_SUCCESS;
+	}
+
+	bench_mbrtowc = setlocale(LC_CTYPE, "C.UTF-8")
+	             || setlocale(LC_CTYPE, "en_US.UTF-8");
+	bench_iconv = iconv_open("UTF-32LE", "UTF-8");
+
+	static uint8_t buf[BENCH_CORPUS_SIZE];
+	struct piece *pieces = malloc((BENCH_CORPUS_SIZE / bench_sizes[0] * 2U)
+	                              * sizeof *pieces);
+	if (!pieces) {
+		(void)fprintf(stderr, "%s: %s\n", v[0], strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	(void)printf("# kernel %s, cycles are %s\n", utf8_kernel(),
+	             bench_cycles() ? "TSC reference cycles" : "not available");
+	(void)printf("%-8s %8s  %-8s %8s %8s\n",
+	             "#corpus", "size", "engine", "GB/s", "cyc/B");
+
+	for (size_t i = 0; i < n_corpora; ++i) {
+		if (!picked(c, v, corpus_name[i], corpus_name, n_corpora))
+			continue;
+
+		corpus_fill(buf, corpus_gen[i], corpus_corrupt[i]);
+
+		for (size_t s = 0; s < sizeof bench_sizes / sizeof *bench_sizes; ++s) {
+			size_t n = cut(pieces, buf, bench_sizes[s]);
+
+			for (size_t k = 0; k < n_engines; ++k) {
+				if (!picked(c, v, engine_name[k], engine_name, n_engines)
+				    || (corpus_corrupt[i] && !engine_recovers[k])
+				    || ((engine_run[k] == run_mbrtowc
+				         || engine_run[k] == run_wcwidth)
+				        && !bench_mbrtowc)
+				    || (engine_run[k] == run_iconv
+				        && bench_iconv == (iconv_t)-1))
+					continue;
+
+				measure(corpus_name[i], bench_sizes[s],
+				        engine_name[k], engine_run[k], pieces, n);
+			}
+		}
+	}
+
+	if (bench_iconv != (iconv_t)-1)
+		(void)iconv_close(bench_iconv);
+	free(pieces);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file gen-nfc.c
+ * @brief Generate the NFC quick check table of `utf8_nfc_lut.h`
+ *        from the Unicode Character Database.
+ *
+ * Usage: `gen-nfc DerivedNormalizationProps.txt DerivedCombiningClass.txt`
+ *
+ * The table is written to standard output.
+ *
+ * @author Juuso Alasuutari
+ */
+#include "gen-ucd.h"
+
+enum {
+	BLK_BITS = 5,         //!< Code points per block, log2
+	BLK_SIZE = 1 << BLK_BITS,
+	MAX_BLK  = 256,       //!< Block numbers must fit in a byte
+	MAX_RANK = 64,        //!< Combining class ranks must fit in 6 bits
+};
+
+/** @brief NFC_QC of each code point: 0 Yes, 1 No, 2 Maybe. */
+static uint8_t qc[UCD_CP_END];
+
+/** @brief Canonical combining class of each code point. */
+static uint8_t ccc[UCD_CP_END];
+
+/** @brief Unique blocks of entries. */
+static uint8_t blk[MAX_BLK][BLK_SIZE];
+
+/** @brief Block number of each block of code points. */
+static uint8_t idx[UCD_CP_END / BLK_SIZE];
+
+/** @brief The NFC_QC values of `DerivedNormalizationProps.txt`. */
+static int
+map_qc (char const *value)
+{
+	if (strncmp(value, "NFC_QC", 6))
+		return -1;
+
+	value += 6;
+	value += strspn(value, " \t;");
+	return *value == 'N' ? 1 : *value == 'M' ? 2 : -1;
+}
+
+/** @brief The values of `DerivedCombiningClass.txt`. */
+static int
+map_ccc (char const *value)
+{
+	char *end;
+	unsigned long v = strtoul(value, &end, 10);
+	return end != value && v < 256U ? (int)v : -1;
+}
+
+int
+main (int    argc,
+      char **argv)
+{
+	if (argc != 3) {
+		(void)fprintf(stderr, "usage: %s DerivedNormalizationProps.txt "
+		              "DerivedCombiningClass.txt\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	char qc_ver[32] = "", ccc_ver[32] = "";
+	int e = ucd_read(argv[1], qc_ver, qc, map_qc);
+	if (e) {
+		(void)fprintf(stderr, "error: %s: %s\n", argv[1], strerror(e));
+		return EXIT_FAILURE;
+	}
+
+	e = ucd_read(argv[2], ccc_ver, ccc, map_ccc);
+	if (e) {
+		(void)fprintf(stderr, "error: %s: %s\n", argv[2], strerror(e));
+		return EXIT_FAILURE;
+	}
+
+	// Only the order of combining classes matters, and there are
+	// few enough of them in use to number them in 6 bits
+	uint8_t rank[256] = {0};
+	unsigned n_rank = 0;
+	for (uint32_t c = 0; c < UCD_CP_END; ++c)
+		rank[ccc[c]] = 1;
+	rank[0] = 0;
+	for (unsigned v = 1; v < 256U; ++v) {
+		if (!rank[v])
+			continue;
+		if (++n_rank == MAX_RANK) {
+			(void)fputs("error: too many combining classes\n", stderr);
+			return EXIT_FAILURE;
+		}
+		rank[v] = (uint8_t)n_rank;
+	}
+
+	// Code points from the end of the table on are all Yes and 0
+	uint32_t end = UCD_CP_END;
+	while (end && !qc[end - 1] && !ccc[end - 1])
+		--end;
+	end = (end + BLK_SIZE - 1U) & ~(uint32_t)(BLK_SIZE - 1);
+
+	unsigned n_blk = 0;
+	for (uint32_t i = 0; i < end / BLK_SIZE; ++i) {
+		uint8_t b[BLK_SIZE];
+		for (unsigned j = 0; j < BLK_SIZE; ++j) {
+			uint32_t c = i * BLK_SIZE + j;
+			b[j] = (uint8_t)(qc[c] << 6U | rank[ccc[c]]);
+		}
+
+		unsigned k = 0;
+		while (k < n_blk && memcmp(blk[k], b, sizeof b))
+			++k;
+		if (k == n_blk) {
+			if (n_blk == MAX_BLK) {
+				(void)fputs("error: too many blocks\n", stderr);
+				return EXIT_FAILURE;
+			}
+			memcpy(blk[n_blk++], b, sizeof b);
+		}
+		idx[i] = (uint8_t)k;
+	}
+
+	(void)printf(
+		"/* SPDX-License-Identifier: LGPL-3.0-or-later */\n"
+		"/** @file utf8_nfc_lut.h\n"
+		" * @brief NFC quick check table, generated by gen-nfc from\n"
+		" *        DerivedNormalizationProps-%s and\n"
+		" *        DerivedCombiningClass-%s.\n"
+		" */\n"
+		"#ifndef CUTF8_SRC_UTF8_NFC_LUT_H_\n"
+		"#define CUTF8_SRC_UTF8_NFC_LUT_H_\n"
+		"\n"
+		"#include \"utf8_impl.h\"\n"
+		"\n"
+		"/** @brief Code points from this on are NFC_QC=Yes and of\n"
+		" *         combining class 0. */\n"
+		"constexpr static const uint32_t utf8_nfc_end = 0x%05xU;\n"
+		"\n"
+		"/** @brief Code points per block, log2. */\n"
+		"constexpr static const unsigned utf8_nfc_blk_bits = %uU;\n"
+		"\n"
+		"/** @brief Block number of each block of code points. */\n"
+		"constexpr static const uint8_t utf8_nfc_idx[%u] = {",
+		qc_ver, ccc_ver, end, BLK_BITS, end / BLK_SIZE);
+
+	for (unsigned i = 0; i < end / BLK_SIZE; ++i)
+		(void)printf("%s%3u,", i % 12U ? " " : "\n\t", idx[i]);
+
+	(void)printf(
+		"\n};\n"
+		"\n"
+		"/** @brief Entries of the code points of each block, NFC_QC\n"
+		" *         in bits 6-7 as 0 Yes, 1 No or 2 Maybe, and the rank\n"
+		" *         of the canonical combining class in bits 0-5. */\n"
+		"constexpr static const uint8_t utf8_nfc_blk[%u][%u] = {",
+		n_blk, BLK_SIZE);
+
+	for (unsigned k = 0; k < n_blk; ++k) {
+		(void)printf("\n\t{ // %u", k);
+		for (unsigned j = 0; j < BLK_SIZE; ++j)
+			(void)printf("%s0x%02x,", j % 8U ? " " : "\n\t\t",
+			             blk[k][j]);
+		(void)fputs("\n\t},", stdout);
+	}
+
+	(void)fputs("\n};\n\n#endif /* CUTF8_SRC_UTF8_NFC_LUT_H_ */\n",
+	            stdout);
+
+	return ferror(stdout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
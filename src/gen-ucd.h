@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file gen-ucd.h
+ * @brief Unicode Character Database file reading shared by the table
+ *        generators.
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef CUTF8_SRC_GEN_UCD_H_
+#define CUTF8_SRC_GEN_UCD_H_
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** @brief One past the last code point. */
+#define UCD_CP_END 0x110000U
+
+/**
+ * @brief Parse a `XXXX[..YYYY] ; field[; field]...` line of a UCD file.
+ *
+ * @param line  The line, modified in place.
+ * @param first Receives the first code point of the range.
+ * @param last  Receives the last code point of the range.
+ * @param value Receives the fields after the range, with the comment
+ *              and surrounding whitespace stripped.
+ * @return `true` if the line has a range and a value, `false` for
+ *         comments, empty lines and anything unrecognised.
+ */
+static bool
+ucd_parse_line (char     *line,
+                uint32_t *first,
+                uint32_t *last,
+                char    **value)
+{
+	char *end;
+	unsigned long a = strtoul(line, &end, 16), b = a;
+	if (end == line)
+		return false;
+
+	if (end[0] == '.' && end[1] == '.') {
+		line = end + 2;
+		b = strtoul(line, &end, 16);
+		if (end == line)
+			return false;
+	}
+
+	end += strspn(end, " \t");
+	if (*end++ != ';' || a > b || b >= UCD_CP_END)
+		return false;
+
+	end += strspn(end, " \t");
+	size_t n = strcspn(end, "#\r\n");
+	while (n && (end[n - 1] == ' ' || end[n - 1] == '\t'))
+		--n;
+	end[n] = '\0';
+	if (!n)
+		return false;
+
+	*first = (uint32_t)a;
+	*last = (uint32_t)b;
+	*value = end;
+	return true;
+}
+
+/**
+ * @brief Read a UCD file into a table of per code point values.
+ *
+ * Each listed code point is assigned the value `map` returns for its
+ * fields, unless that is negative.
+ *
+ * @param path    Path of the file.
+ * @param version Receives the Unicode version from the first line.
+ * @param table   The table, `UCD_CP_END` entries.
+ * @param map     Mapping from the fields of a line to a value.
+ * @return 0 on success, otherwise an error code.
+ */
+static int
+ucd_read (char const *path,
+          char        version[static 32],
+          uint8_t    *table,
+          int       (*map)(char const *))
+{
+	FILE *f = fopen(path, "r");
+	if (!f)
+		return errno;
+
+	char line[512];
+	for (bool first_line = true; fgets(line, sizeof line, f);
+	     first_line = false) {
+		uint32_t a, b;
+		char *value;
+
+		if (first_line) {
+			char const *v = strchr(line, '-');
+			if (v && sscanf(v + 1, "%31[0-9.]", version) == 1) {
+				size_t n = strlen(version);
+				if (n && version[n - 1] == '.')
+					version[n - 1] = '\0';
+			}
+		}
+
+		if (!ucd_parse_line(line, &a, &b, &value))
+			continue;
+
+		int w = map(value);
+		if (w >= 0)
+			memset(&table[a], w, b - a + 1U);
+	}
+
+	int e = ferror(f) ? EIO : 0;
+	(void)fclose(f);
+	return e;
+}
+
+#endif /* CUTF8_SRC_GEN_UCD_H_ */
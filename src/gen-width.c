@@ -0,0 +1,177 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file gen-width.c
+ * @brief Generate the display width table of `utf8_width_lut.h`
+ *        from the Unicode Character Database.
+ *
+ * Usage: `gen-width EastAsianWidth.txt DerivedGeneralCategory.txt`
+ *
+ * The table is written to standard output.
+ *
+ * @author Juuso Alasuutari
+ */
+#include "gen-ucd.h"
+
+enum {
+	BLK_BITS  = 8,        //!< Code points per block, log2
+	BLK_SIZE  = 1 << BLK_BITS,
+	BLK_BYTES = BLK_SIZE / 4, //!< Four 2-bit widths per byte
+	N_IDX     = UCD_CP_END / BLK_SIZE,
+	MAX_BLK   = 256,      //!< Block numbers must fit in a byte
+};
+
+/** @brief Width of each code point, 0, 1 or 2 columns. */
+static uint8_t width[UCD_CP_END];
+
+/** @brief Unique blocks of packed widths. */
+static uint8_t blk[MAX_BLK][BLK_BYTES];
+
+/** @brief Block number of each block of code points. */
+static uint8_t idx[N_IDX];
+
+/**
+ * @brief Code point ranges which default to East Asian Wide when
+ *        not listed in `EastAsianWidth.txt`, as given in UAX #11.
+ */
+static const uint32_t default_wide[][2] = {
+	{0x03400, 0x04dbf},
+	{0x04e00, 0x09fff},
+	{0x0f900, 0x0faff},
+	{0x20000, 0x2fffd},
+	{0x30000, 0x3fffd},
+};
+
+/**
+ * @brief The Prepended_Concatenation_Mark characters of `PropList.txt`,
+ *        format characters with a visible glyph.
+ */
+static const uint32_t shown[][2] = {
+	{0x00600, 0x00605},
+	{0x006dd, 0x006dd},
+	{0x0070f, 0x0070f},
+	{0x00890, 0x00891},
+	{0x008e2, 0x008e2},
+	{0x110bd, 0x110bd},
+	{0x110cd, 0x110cd},
+};
+
+/** @brief East Asian Wide and Fullwidth are two columns. */
+static int
+map_eaw (char const *value)
+{
+	return !strcmp(value, "W") || !strcmp(value, "F") ? 2 : 1;
+}
+
+/** @brief Marks, format and control characters and line and paragraph
+ *         separators take no columns of their own. */
+static int
+map_gc (char const *value)
+{
+	static char const *const zero[] = {
+		"Mn", "Me", "Cf", "Cc", "Zl", "Zp",
+	};
+
+	for (size_t i = 0; i < sizeof zero / sizeof *zero; ++i)
+		if (!strcmp(value, zero[i]))
+			return 0;
+
+	return -1;
+}
+
+int
+main (int    argc,
+      char **argv)
+{
+	if (argc != 3) {
+		(void)fprintf(stderr, "usage: %s EastAsianWidth.txt "
+		              "DerivedGeneralCategory.txt\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	memset(width, 1, sizeof width);
+	for (size_t i = 0; i < sizeof default_wide / sizeof *default_wide;
+	     ++i)
+		memset(&width[default_wide[i][0]], 2,
+		       default_wide[i][1] - default_wide[i][0] + 1U);
+
+	char eaw_ver[32] = "", gc_ver[32] = "";
+	int e = ucd_read(argv[1], eaw_ver, width, map_eaw);
+	if (e) {
+		(void)fprintf(stderr, "error: %s: %s\n", argv[1], strerror(e));
+		return EXIT_FAILURE;
+	}
+
+	e = ucd_read(argv[2], gc_ver, width, map_gc);
+	if (e) {
+		(void)fprintf(stderr, "error: %s: %s\n", argv[2], strerror(e));
+		return EXIT_FAILURE;
+	}
+
+	// Soft hyphen and the prepended concatenation marks are Cf but
+	// displayed, like in wcwidth() of glibc, and conjoining Hangul
+	// vowels and trailing consonants combine into the preceding
+	// syllable
+	width[0x00ad] = 1;
+	for (size_t i = 0; i < sizeof shown / sizeof *shown; ++i)
+		memset(&width[shown[i][0]], 1, shown[i][1] - shown[i][0] + 1U);
+	memset(&width[0x1160], 0, 0x11ff - 0x1160 + 1);
+	memset(&width[0xd7b0], 0, 0xd7ff - 0xd7b0 + 1);
+
+	unsigned n_blk = 0;
+	for (unsigned i = 0; i < N_IDX; ++i) {
+		uint8_t b[BLK_BYTES] = {0};
+		for (unsigned j = 0; j < BLK_SIZE; ++j)
+			b[j / 4U] |= (uint8_t)(width[i * BLK_SIZE + j]
+			                       << (j % 4U * 2U));
+
+		unsigned k = 0;
+		while (k < n_blk && memcmp(blk[k], b, sizeof b))
+			++k;
+		if (k == n_blk) {
+			if (n_blk == MAX_BLK) {
+				(void)fputs("error: too many blocks\n", stderr);
+				return EXIT_FAILURE;
+			}
+			memcpy(blk[n_blk++], b, sizeof b);
+		}
+		idx[i] = (uint8_t)k;
+	}
+
+	(void)printf(
+		"/* SPDX-License-Identifier: LGPL-3.0-or-later */\n"
+		"/** @file utf8_width_lut.h\n"
+		" * @brief Display width table, generated by gen-width from\n"
+		" *        EastAsianWidth-%s and DerivedGeneralCategory-%s.\n"
+		" */\n"
+		"#ifndef CUTF8_SRC_UTF8_WIDTH_LUT_H_\n"
+		"#define CUTF8_SRC_UTF8_WIDTH_LUT_H_\n"
+		"\n"
+		"#include \"utf8_impl.h\"\n"
+		"\n"
+		"/** @brief Block number of each block of %u code points. */\n"
+		"constexpr static const uint8_t utf8_width_idx[%u] = {",
+		eaw_ver, gc_ver, BLK_SIZE, N_IDX);
+
+	for (unsigned i = 0; i < N_IDX; ++i)
+		(void)printf("%s%3u,", i % 12U ? " " : "\n\t", idx[i]);
+
+	(void)printf(
+		"\n};\n"
+		"\n"
+		"/** @brief Widths of the code points of each block, four\n"
+		" *         2-bit widths per byte with the first in bits 0-1. */\n"
+		"constexpr static const uint8_t utf8_width_blk[%u][%u] = {",
+		n_blk, BLK_BYTES);
+
+	for (unsigned k = 0; k < n_blk; ++k) {
+		(void)printf("\n\t{ // %u", k);
+		for (unsigned j = 0; j < BLK_BYTES; ++j)
+			(void)printf("%s0x%02x,", j % 8U ? " " : "\n\t\t",
+			             blk[k][j]);
+		(void)fputs("\n\t},", stdout);
+	}
+
+	(void)fputs("\n};\n\n#endif /* CUTF8_SRC_UTF8_WIDTH_LUT_H_ */\n",
+	            stdout);
+
+	return ferror(stdout) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
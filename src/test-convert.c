@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file test-convert.c
+ *
+ * @brief Output bound tests for the UTF-32 and UTF-16 to UTF-8
+ *        encoders.
+ *
+ * Encodes input of one, two and three byte code points into output
+ * buffers of exactly the documented worst case size, `4 * len` bytes
+ * for UTF-32 and `3 * len` bytes for UTF-16, placed right before an
+ * inaccessible page so that any store past the end faults. For three
+ * byte code points in UTF-16 that is also the size of the result. The
+ * vector kernel is picked as usual, so `make check` runs the program
+ * once per value of the `UTF8_KERNEL` environment variable.
+ *
+ * @author Juuso Alasuutari
+ */
+#define _GNU_SOURCE // MAP_ANONYMOUS
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "test-util.h"
+
+/** Longest input tested, in code units. */
+#define TEST_LEN_MAX 80U
+
+/**
+ * @brief Input encodings.
+ */
+enum test_form {
+	test_utf32,
+	test_utf16le,
+	test_utf16be,
+};
+
+/** Names of @ref test_form values. */
+static char const *const test_form_name[] = {
+	[test_utf32  ] = "utf32",
+	[test_utf16le] = "utf16le",
+	[test_utf16be] = "utf16be",
+};
+
+/** Worst case output bytes per input code unit of each encoding. */
+static size_t const test_bound_mul[] = {
+	[test_utf32  ] = 4U,
+	[test_utf16le] = 3U,
+	[test_utf16be] = 3U,
+};
+
+/** First code point of each length of UTF-8 sequence tested. */
+static uint32_t const test_base[] = {0x41U, 0x400U, 0x4e00U};
+
+/**
+ * @brief Encode `len` code points from `base` on into a buffer which
+ *        ends at `end`, and check the result.
+ *
+ * @return `true` if the output is as expected.
+ */
+static bool
+test_bound (enum test_form  form,
+            uint32_t        base,
+            size_t          len,
+            uint8_t *const  end)
+{
+	static uint32_t in32[TEST_LEN_MAX];
+	static uint16_t in16[TEST_LEN_MAX];
+	static uint8_t want[3U * TEST_LEN_MAX];
+	size_t n = 0;
+
+	for (size_t i = 0; i < len; ++i) {
+		uint32_t cp = base + (uint32_t)i;
+		in32[i] = cp;
+		in16[i] = form == test_utf16be
+		        ? (uint16_t)(cp >> 8U | (cp & 0xffU) << 8U)
+		        : (uint16_t)cp;
+		n += put_utf8(&want[n], cp);
+	}
+
+	uint8_t *const dst = end - test_bound_mul[form] * len;
+	struct utf8_conv c = form == test_utf32
+	                   ? utf32_to_utf8(dst, in32, len, utf8_stop)
+	                   : form == test_utf16le
+	                   ? utf16le_to_utf8(dst, in16, len, utf8_stop)
+	                   : utf16be_to_utf8(dst, in16, len, utf8_stop);
+
+	if (c.error || c.in != len || c.out != n || memcmp(dst, want, n)) {
+		(void)fprintf(stderr, "%s: U+%04X x %zu: in=%zu out=%zu "
+		              "error=%d, expected out=%zu\n",
+		              test_form_name[form], (unsigned)base, len,
+		              c.in, c.out, c.error, n);
+		return false;
+	}
+
+	return true;
+}
+
+int
+main (int    c,
+      char **v)
+{
+	(void)c;
+
+	if (test_skip(v[0]))
+		return EXIT_SUCCESS;
+
+	// The output buffers end where the guard page begins
+	size_t const page = (size_t)sysconf(_SC_PAGESIZE);
+	size_t const size = (4U * TEST_LEN_MAX + page - 1U) / page * page;
+	uint8_t *const map = mmap(nullptr, size + page, PROT_READ | PROT_WRITE,
+	                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED || mprotect(map + size, page, PROT_NONE)) {
+		(void)fprintf(stderr, "%s: %s\n", v[0], strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	unsigned failed = 0;
+	for (unsigned f = test_utf32; f <= test_utf16be; ++f) {
+		for (size_t b = 0; b < sizeof test_base / sizeof *test_base; ++b) {
+			for (size_t len = 1U; len <= TEST_LEN_MAX; ++len)
+				failed += !test_bound((enum test_form)f,
+				                      test_base[b], len,
+				                      map + size);
+		}
+	}
+
+	(void)munmap(map, size + page);
+	(void)printf("kernel %s: %u failed\n", utf8_kernel(), failed);
+
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
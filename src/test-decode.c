@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file test-decode.c
+ *
+ * @brief Exhaustive test of @ref utf8_decode_next() against the
+ *        table driven parser.
+ *
+ * Goes through every input of one to four bytes whose bytes before
+ * the last one are a valid but incomplete sequence, which covers every
+ * path through a sequence, and checks that @ref utf8_decode_next()
+ * agrees with @ref utf8_parse_span() on the status, the length and
+ * the code point. Each input is decoded as the whole buffer, and
+ * again with bytes after it, which must not change the result unless
+ * the input was cut short.
+ *
+ * @author Juuso Alasuutari
+ */
+#include "test-util.h"
+
+/** The failures so far. */
+static unsigned test_failed;
+
+/** Inputs tested. */
+static unsigned long test_count;
+
+/**
+ * @brief Get the expected result for `len` bytes with the parser,
+ *        feeding it one more byte at a time.
+ */
+static struct utf8_decoded
+ref_decode (uint8_t const *const buf,
+            size_t               len)
+{
+	for (size_t k = 1U; k <= len; ++k) {
+		struct utf8 u8p = utf8();
+		struct utf8_span sp = utf8_parse_span(&u8p, buf, buf + k);
+
+		if (u8p.error) {
+			size_t f = (size_t)(sp.ptr - buf);
+			return (struct utf8_decoded){
+				0xfffdU, (uint8_t)(f ? f : 1U),
+				utf8_decode_invalid
+			};
+		}
+
+		if (sp.count) {
+			uint32_t cp = k == 1U ? buf[0] : buf[0] & (0x7fU >> k);
+			for (size_t j = 1U; j < k; ++j)
+				cp = cp << 6U | (buf[j] & 0x3fU);
+			return (struct utf8_decoded){
+				cp, (uint8_t)k, utf8_decode_ok
+			};
+		}
+	}
+
+	return (struct utf8_decoded){
+		0xfffdU, (uint8_t)len, utf8_decode_truncated
+	};
+}
+
+/**
+ * @brief Decode `len` bytes of `buf`, which has room for 3 more, with
+ *        and without bytes after them.
+ *
+ * @return `true` if the bytes are a valid but incomplete sequence.
+ */
+static bool
+test_one (uint8_t *const buf,
+          size_t         len)
+{
+	static uint8_t const pad[] = {0x80U, 0xbfU, 'a'};
+	struct utf8_decoded want = ref_decode(buf, len);
+
+	for (size_t p = 0; p < sizeof pad; ++p) {
+		size_t n = len + (p ? 3U : 0U);
+		(void)memset(&buf[len], pad[p], 3U);
+
+		// Bytes after a complete or invalid sequence make no
+		// difference, but they can complete a truncated one
+		struct utf8_decoded w = p ? ref_decode(buf, n) : want;
+		struct utf8_decoded d = utf8_decode_next(buf, buf + n);
+		++test_count;
+
+		if (d.code_point != w.code_point || d.len != w.len
+		    || d.status != w.status
+		    || (want.status != utf8_decode_truncated
+		        && (w.status != want.status || w.len != want.len))) {
+			(void)fprintf(stderr, "%02x %02x %02x %02x / %zu: got "
+			              "U+%04X/%u/%d, want U+%04X/%u/%d\n",
+			              buf[0], buf[1], buf[2], buf[3], n,
+			              (unsigned)d.code_point, d.len, (int)d.status,
+			              (unsigned)w.code_point, w.len, (int)w.status);
+			++test_failed;
+		}
+	}
+
+	return want.status == utf8_decode_truncated;
+}
+
+/**
+ * @brief Try every byte after `len` bytes which are a valid but
+ *        incomplete sequence, and recurse on those which keep it so.
+ */
+static void
+test_tree (uint8_t *const buf,
+           size_t         len)
+{
+	for (unsigned b = 0; b < 256U && test_failed < 20U; ++b) {
+		buf[len] = (uint8_t)b;
+		if (test_one(buf, len + 1U) && len + 1U < 4U)
+			test_tree(buf, len + 1U);
+	}
+}
+
+int
+main (void)
+{
+	uint8_t buf[8] = {0};
+
+	struct utf8_decoded d = utf8_decode_next(buf, buf);
+	if (d.code_point != 0xfffdU || d.len || d.status != utf8_decode_truncated) {
+		(void)fprintf(stderr, "empty input: got U+%04X/%u/%d\n",
+		              (unsigned)d.code_point, d.len, (int)d.status);
+		++test_failed;
+	}
+
+	test_tree(buf, 0);
+
+	(void)printf("%lu inputs: %u failed\n", test_count, test_failed);
+
+	return test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
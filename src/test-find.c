@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file test-find.c
+ *
+ * @brief Differential tests of the substring search against
+ *        `memmem()`.
+ *
+ * Searches random haystacks for needles taken from them, altered
+ * copies of those, random and invalid needles, and every code point
+ * length, and checks @ref utf8_find() and @ref utf8_find_code_point()
+ * against `memmem()`. Haystacks are built from a small alphabet so
+ * that candidate matches are common, and each is copied to a buffer
+ * of its exact size so that out of bounds reads show up under a
+ * sanitizer. The vector kernel is picked as usual, so `make check`
+ * runs the program once per value of the `UTF8_KERNEL` environment
+ * variable.
+ *
+ * @author Juuso Alasuutari
+ */
+#define _GNU_SOURCE // memmem()
+
+#include "test-util.h"
+
+/** Longest haystack tested. */
+#define TEST_LEN_MAX 5000U
+
+/** Longest needle tested. */
+#define TEST_NEEDLE_MAX 200U
+
+/** The failures so far. */
+static unsigned test_failed;
+
+/**
+ * @brief Fill a buffer with valid UTF-8 from a few code points, or
+ *        with arbitrary input as @ref test_fill() does.
+ */
+static void
+test_hay (uint8_t *const  buf,
+          size_t          len,
+          uint64_t *const s)
+{
+	if (rnd(s) % 4U == 0) {
+		test_fill(buf, len, s);
+		return;
+	}
+
+	uint32_t abc[4];
+	for (size_t i = 0; i < sizeof abc / sizeof *abc; ++i)
+		abc[i] = rnd_cp(s);
+
+	size_t n = 0;
+	while (len - n >= 4U)
+		n += put_utf8(&buf[n], abc[rnd(s) % (sizeof abc / sizeof *abc)]);
+	(void)memset(&buf[n], 'a', len - n);
+}
+
+/**
+ * @brief Make a needle of up to `max` bytes.
+ *
+ * @return The size of the needle.
+ */
+static size_t
+test_needle (uint8_t *const       dst,
+             size_t               max,
+             uint8_t const *const hay,
+             size_t               len,
+             uint64_t *const      s)
+{
+	size_t k = rnd(s) % 8U ? 1U + rnd_below(s, 16U)
+	                       : 1U + rnd_below(s, max);
+	if (k > max)
+		k = max;
+
+	switch (rnd(s) % 4U) {
+	case 0:
+		// Random, and more often than not invalid
+		test_fill(dst, k, s);
+		return k;
+
+	case 1:
+		// From the haystack, with the last byte changed
+		if (k > len)
+			break;
+		(void)memcpy(dst, &hay[rnd_below(s, len - k + 1U)], k);
+		dst[k - 1U] ^= (uint8_t)(1U + rnd(s) % 0x3fU);
+		return k;
+
+	default:
+		// From the haystack
+		if (k > len)
+			break;
+		(void)memcpy(dst, &hay[rnd_below(s, len - k + 1U)], k);
+		return k;
+	}
+
+	// Longer than the haystack
+	size_t n = 0;
+	while (max - n >= 4U && n < k)
+		n += put_utf8(&dst[n], rnd_cp(s));
+	return n;
+}
+
+/**
+ * @brief The expected result of @ref utf8_find().
+ */
+static uint8_t const *
+ref_find (uint8_t const *const hay,
+          size_t               len,
+          uint8_t const *const needle,
+          size_t               k)
+{
+	if (!k)
+		return hay;
+
+	// Only a valid needle can match, and it can't begin with a
+	// continuation byte
+	if ((needle[0] & 0xc0U) == 0x80U || !utf8_validate(needle, k))
+		return nullptr;
+
+	return memmem(hay, len, needle, k);
+}
+
+int
+main (int    c,
+      char **v)
+{
+	(void)c;
+
+	if (test_skip(v[0]))
+		return EXIT_SUCCESS;
+
+	static uint8_t hay[TEST_LEN_MAX];
+	static uint8_t needle[TEST_NEEDLE_MAX];
+
+	for (unsigned i = 0; i < 100000U && test_failed < 20U; ++i) {
+		uint64_t seed = UINT64_C(0xf1d) + i, s = seed;
+		size_t len = rnd(&s) % 16U ? rnd_below(&s, 200U)
+		                           : rnd_below(&s, TEST_LEN_MAX + 1U);
+		test_hay(hay, len, &s);
+		size_t k = test_needle(needle, TEST_NEEDLE_MAX, hay, len, &s);
+
+		uint8_t *const p = malloc(len + !len);
+		if (!p) {
+			(void)fprintf(stderr, "%s: out of memory\n", v[0]);
+			return EXIT_FAILURE;
+		}
+		(void)memcpy(p, hay, len);
+
+		uint8_t const *want = ref_find(p, len, needle, k);
+		uint8_t const *got = utf8_find(p, len, needle, k);
+		if (got != want) {
+			(void)fprintf(stderr, "seed %#llx: len %zu, needle %zu: "
+			              "got %td, want %td\n",
+			              (unsigned long long)seed, len, k,
+			              got ? got - p : -1, want ? want - p : -1);
+			++test_failed;
+		}
+
+		uint32_t cp = rnd(&s) % 8U ? rnd_cp(&s) : rnd(&s) % 0x110800U;
+		if (cp >= 0x110000U)
+			cp = 0xd800U + (cp & 0x7ffU);
+		uint8_t b[4];
+		k = (cp & ~0x7ffU) == 0xd800U ? 0 : put_utf8(b, cp);
+		want = k ? memmem(p, len, b, k) : nullptr;
+		got = utf8_find_code_point(p, len, cp);
+		if (got != want) {
+			(void)fprintf(stderr, "seed %#llx: len %zu, U+%04X: "
+			              "got %td, want %td\n",
+			              (unsigned long long)seed, len, (unsigned)cp,
+			              got ? got - p : -1, want ? want - p : -1);
+			++test_failed;
+		}
+
+		free(p);
+	}
+
+	(void)printf("kernel %s: %u failed\n", utf8_kernel(), test_failed);
+
+	return test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,282 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file test-nfc.c
+ *
+ * @brief Tests of the NFC quick check.
+ *
+ * Checks @ref utf8_nfc_quick_check() on known Yes, Maybe and No
+ * cases, including combining marks in and out of canonical order,
+ * which also tests the data of `utf8_nfc_lut.h` after it has been
+ * regenerated. The cases are repeated behind prefixes of around
+ * 4 KiB so that the block cut of the validation falls inside and
+ * between their sequences. Random input is then checked against a
+ * reference which looks up every code point, and against a copy of
+ * the quick check built without the vector run skip. The vector
+ * kernel is picked as usual, so `make check` runs the program once
+ * per value of the `UTF8_KERNEL` environment variable.
+ *
+ * @author Juuso Alasuutari
+ */
+#include <errno.h>
+
+// A copy of the quick check without the vector run skip, which also
+// gives access to the table lookup
+#define UTF8_NO_SIMD
+#define utf8_nfc_quick_check test_nfc_quick_check_noskip
+#include "utf8_nfc.c"
+#undef utf8_nfc_quick_check
+
+// The declaration in utf8.h was renamed along with the copy
+extern struct utf8_nfc
+utf8_nfc_quick_check (uint8_t const *ptr,
+                      size_t         len) utf8_nonnull_in;
+
+#include "test-util.h"
+
+/** Longest random input tested. */
+#define TEST_LEN_MAX 12000U
+
+/** Longest prefix of the known cases. */
+#define TEST_PREFIX_MAX 4104U
+
+/**
+ * @brief A known case.
+ */
+struct test_case {
+	char const      *str;
+	size_t           offset;
+	enum utf8_nfc_qc result;
+	int              error;
+};
+
+/** Known cases. The combining classes are in parentheses. */
+static struct test_case const test_case[] = {
+	{"",                                  0, utf8_nfc_yes,   0},
+	{"abc",                               3, utf8_nfc_yes,   0},
+	// a U+0301 (230), which is NFC_QC=Maybe
+	{"a\xcc\x81",                         1, utf8_nfc_maybe, 0},
+	// e U+0301 (230) U+0300 (230)
+	{"e\xcc\x81\xcc\x80",                 1, utf8_nfc_maybe, 0},
+	// a U+0316 (220) U+0301 (230)
+	{"a\xcc\x96\xcc\x81",                 3, utf8_nfc_maybe, 0},
+	// a U+0301 (230) U+0316 (220): Maybe, then out of order
+	{"a\xcc\x81\xcc\x96",                 1, utf8_nfc_no,    0},
+	// a U+0334 (1) U+0316 (220)
+	{"a\xcc\xb4\xcc\x96",                 5, utf8_nfc_yes,   0},
+	// a U+0316 (220) U+0334 (1)
+	{"a\xcc\x96\xcc\xb4",                 3, utf8_nfc_no,    0},
+	// U+05D0 U+05B0 (10) U+05B1 (11)
+	{"\xd7\x90\xd6\xb0\xd6\xb1",          6, utf8_nfc_yes,   0},
+	// U+05D0 U+05B1 (11) U+05B0 (10)
+	{"\xd7\x90\xd6\xb1\xd6\xb0",          4, utf8_nfc_no,    0},
+	// a U+1E944 (230) U+0316 (220)
+	{"a\xf0\x9e\xa5\x84\xcc\x96",         5, utf8_nfc_no,    0},
+	// U+0340, which is NFC_QC=No
+	{"\xcd\x80",                          0, utf8_nfc_no,    0},
+	// x U+0344, NFC_QC=No
+	{"x\xcd\x84",                         1, utf8_nfc_no,    0},
+	// a U+F900, NFC_QC=No
+	{"a\xef\xa4\x80",                     1, utf8_nfc_no,    0},
+	// U+1100 U+1161, a Hangul vowel which is NFC_QC=Maybe
+	{"\xe1\x84\x80\xe1\x85\xa1",          3, utf8_nfc_maybe, 0},
+	// U+AC00, a precomposed Hangul syllable
+	{"\xea\xb0\x80",                      3, utf8_nfc_yes,   0},
+	{"\xff",                              0, utf8_nfc_no,    EILSEQ},
+	{"ab\xe2\x82",                        2, utf8_nfc_no,    EILSEQ},
+	// a U+0340 0xff: the No comes first
+	{"a\xcd\x80\xff",                     1, utf8_nfc_no,    EILSEQ},
+	// a U+0301 0xc3: the Maybe comes first
+	{"a\xcc\x81\xc3",                     1, utf8_nfc_no,    EILSEQ},
+};
+
+/** The failures so far. */
+static unsigned test_failed;
+
+/**
+ * @brief Compare two results.
+ */
+static bool
+test_same (struct utf8_nfc const a,
+           struct utf8_nfc const b)
+{
+	return a.offset == b.offset && a.result == b.result
+	    && a.error == b.error;
+}
+
+/**
+ * @brief Report a mismatch.
+ */
+static void
+test_report (char const *const     what,
+             unsigned long long    n,
+             size_t                len,
+             struct utf8_nfc const got,
+             struct utf8_nfc const want)
+{
+	(void)fprintf(stderr, "%s %llu, len %zu: got %zu/%d/%d, "
+	              "want %zu/%d/%d\n", what, n, len, got.offset,
+	              (int)got.result, got.error, want.offset,
+	              (int)want.result, want.error);
+	++test_failed;
+}
+
+/**
+ * @brief The quick check, one code point at a time.
+ */
+static struct utf8_nfc
+ref_nfc (uint8_t const *const ptr,
+         size_t               len)
+{
+	struct utf8_check c = utf8_check(ptr, len);
+	struct utf8_nfc ret = {.offset = len, .result = utf8_nfc_yes};
+	unsigned last = 0;
+
+	for (size_t i = 0, n; i < c.offset && ret.result != utf8_nfc_no;
+	     i += n) {
+		uint32_t cp = ptr[i];
+		n = cp < 0x80U ? 1U : cp < 0xe0U ? 2U : cp < 0xf0U ? 3U : 4U;
+		if (n > 1U)
+			cp &= 0x7fU >> n;
+		for (size_t j = 1U; j < n; ++j)
+			cp = cp << 6U | (ptr[i + j] & 0x3fU);
+
+		unsigned e = utf8_nfc_entry(cp);
+		unsigned cls = e & 0x3fU;
+		enum utf8_nfc_qc qc = (enum utf8_nfc_qc)(e >> 6U);
+		if (cls && cls < last)
+			qc = utf8_nfc_no;
+		if (qc != utf8_nfc_yes) {
+			if (ret.result == utf8_nfc_yes)
+				ret.offset = i;
+			ret.result = qc;
+		}
+		last = cls;
+	}
+
+	if (c.error != utf8_valid) {
+		if (ret.result == utf8_nfc_yes)
+			ret.offset = c.offset;
+		ret.result = utf8_nfc_no;
+		ret.error = EILSEQ;
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Run the known cases behind a prefix of `n` bytes, which is
+ *        ASCII, or three byte code points followed by ASCII.
+ */
+static void
+test_known (uint8_t *const buf,
+            size_t         n,
+            bool           wide)
+{
+	size_t i = 0;
+	if (wide) {
+		for (; n - i >= 3U + (n % 7U); i += 3U)
+			(void)memcpy(&buf[i], "\xe4\xb8\x80", 3U);
+	}
+	(void)memset(&buf[i], 'a', n - i);
+
+	for (size_t k = 0; k < sizeof test_case / sizeof *test_case; ++k) {
+		struct test_case const *t = &test_case[k];
+		size_t len = strlen(t->str);
+		(void)memcpy(&buf[n], t->str, len);
+
+		struct utf8_nfc want = {
+			.offset = n + t->offset,
+			.result = t->result,
+			.error  = t->error,
+		};
+		struct utf8_nfc got = utf8_nfc_quick_check(buf, n + len);
+		if (!test_same(got, want))
+			test_report("case", k, n + len, got, want);
+	}
+}
+
+/**
+ * @brief A random code point, mostly from ranges with combining marks
+ *        and other code points which are not NFC_QC=Yes.
+ */
+static uint32_t
+rnd_nfc_cp (uint64_t *const s)
+{
+	uint32_t r = rnd(s) % 100U;
+	return r < 40U ? 0x20U + rnd(s) % 0x5fU
+	     : r < 50U ? 0xa0U + rnd(s) % 0x260U
+	     : r < 75U ? 0x300U + rnd(s) % 0x70U
+	     : r < 80U ? 0x591U + rnd(s) % 0x37U
+	     : r < 85U ? 0x1100U + rnd(s) % 0x100U
+	     : r < 90U ? 0xf900U + rnd(s) % 0x200U
+	     :           rnd_cp(s);
+}
+
+/**
+ * @brief Fill a buffer with random input for the quick check, with
+ *        long ASCII runs at times, and corrupted now and then.
+ */
+static void
+test_nfc_fill (uint8_t *const  buf,
+               size_t          len,
+               uint64_t *const s)
+{
+	size_t n = 0;
+	bool runs = rnd(s) % 2U;
+
+	while (len - n >= 4U) {
+		if (runs && rnd(s) % 16U == 0) {
+			size_t k = rnd_below(s, len - n - 3U);
+			(void)memset(&buf[n], 'a', k);
+			n += k;
+			continue;
+		}
+		n += put_utf8(&buf[n], rnd_nfc_cp(s));
+	}
+	(void)memset(&buf[n], 'a', len - n);
+
+	if (len && rnd(s) % 8U == 0) {
+		char const *t = test_snippet[rnd(s) % (sizeof test_snippet
+		                                       / sizeof *test_snippet)];
+		size_t k = strlen(t);
+		if (k <= len)
+			(void)memcpy(&buf[rnd_below(s, len - k + 1U)], t, k);
+	}
+}
+
+int
+main (int    c,
+      char **v)
+{
+	(void)c;
+
+	if (test_skip(v[0]))
+		return EXIT_SUCCESS;
+
+	static uint8_t buf[TEST_LEN_MAX + TEST_PREFIX_MAX];
+
+	test_known(buf, 0, false);
+	for (size_t n = 4084U; n <= TEST_PREFIX_MAX; ++n) {
+		test_known(buf, n, false);
+		test_known(buf, n, true);
+	}
+
+	for (unsigned i = 0; i < 20000U && test_failed < 20U; ++i) {
+		uint64_t seed = UINT64_C(0x9fc) + i, s = seed;
+		size_t len = rnd(&s) % 8U ? rnd_below(&s, 300U)
+		                          : rnd_below(&s, TEST_LEN_MAX + 1U);
+		test_nfc_fill(buf, len, &s);
+
+		struct utf8_nfc want = ref_nfc(buf, len);
+		struct utf8_nfc got = utf8_nfc_quick_check(buf, len);
+		if (!test_same(got, want))
+			test_report("seed", seed, len, got, want);
+
+		got = test_nfc_quick_check_noskip(buf, len);
+		if (!test_same(got, want))
+			test_report("no skip, seed", seed, len, got, want);
+	}
+
+	(void)printf("kernel %s: %u failed\n", utf8_kernel(), test_failed);
+
+	return test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -4,12 +4,16 @@
  * @author Juuso Alasuutari
  */
 #include <errno.h>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #define PROGNAME "test-utf8"
-#define SYNOPSIS "[OPTION]... [--] [STRING]..."
+#define SYNOPSIS "[OPTION]... [--] [STRING|FILE]..."
 #define PURPOSE  "Inspect UTF-8 encoded strings"
 
 #define OPTIONS(X)                              \
@@ -25,6 +29,9 @@
 	X(boolean, join, 'j', "join",           \
 	  "treat arguments as one string")      \
 	                                        \
+	X(boolean, file, 'f', "file",           \
+	  "treat arguments as file paths")      \
+	                                        \
 	X(boolean, print, 'p', "print",         \
 	  "print strings even when counting")   \
 	                                        \
@@ -34,16 +41,38 @@
 	X(boolean, quiet, 'q', "quiet",         \
 	  "report invalid UTF-8 via exit code") \
 	                                        \
+	X(boolean, width, 'w', "width",         \
+	  "print terminal display widths")      \
+	                                        \
 	X(boolean, graph, 'g', "graph",         \
 	  "dump UTF-8 state machine graph (DOT)")
 
 #define DETAILS \
  "The default behaviour without option arguments is to\n" \
  "print input strings on different lines, substituting\n" \
- "the replacement symbol U+FFFD for invalid sequences."
+ "the replacement symbol U+FFFD for invalid sequences.\n" \
+ "\n" \
+ "With --file the arguments name files to read instead,\n" \
+ "- meaning standard input. Input is memory-mapped when\n" \
+ "possible and read in fixed-size blocks otherwise.\n" \
+ "\n" \
+ "With --width the number of terminal columns of each\n" \
+ "string is printed instead, followed by the string if\n" \
+ "--print is also given." \
+ PROFILE_DETAILS
+
+#ifdef UTF8_PROFILE
+# define PROFILE_DETAILS "\n\n" \
+ "With --graph any arguments are run through the state\n" \
+ "machine first, and the graph edges are weighted with\n" \
+ "the state transitions counted."
+#else /* UTF8_PROFILE */
+# define PROFILE_DETAILS
+#endif /* UTF8_PROFILE */
 
 #include "letopt/src/letopt.h"
 
+#undef PROFILE_DETAILS
 #undef DETAILS
 #undef OPTIONS
 #undef PURPOSE
@@ -78,12 +107,47 @@ static struct uz2 {
 	return ret;
 }
 
+/** Inspection state carried over from one input span to the next */
+struct inspect {
+	struct utf8 u8p;
+	size_t      n_chars;
+	size_t      n_bytes;
+	bool        bytes;
+	bool        chars;
+	bool        print;
+	bool        skip;
+	char        tail;    //!< Last byte printed in file mode
+	uint8_t     n_part;  //!< Length of `part`
+	uint8_t     part[3]; //!< Incomplete sequence left to print
+};
+
+/** File mode buffer and mapping window sizes */
+enum {
+	FILE_OUT_SIZE    = 1 << 16, //!< Output buffer, flushed per span
+	FILE_READ_SIZE   = 1 << 20, //!< Block size for unmappable input
+	FILE_WINDOW_SIZE = 1 << 24, //!< Mapped bytes inspected per span
+};
+
+static char *
+inspect (struct inspect *in,
+         uint8_t const  *p,
+         uint8_t const  *end,
+         char           *out,
+         bool            last);
+
+static int
+inspect_files (struct letopt  *opt,
+               struct inspect *in);
+
 static int
 arg_conflict (struct letopt *opt);
 
 static int
 dump_utf8_graph (struct letopt *opt);
 
+static int
+print_widths (struct letopt *opt);
+
 int
 main (int    c,
       char **v)
@@ -99,6 +163,32 @@ main (int    c,
 	if (letopt_nargs(&opt) < 1 || opt.m_help)
 		letopt_helpful_exit(&opt);
 
+	if (opt.m_width)
+		return print_widths(&opt);
+
+	if (opt.m_file)
+		return inspect_files(&opt, &(struct inspect) {
+			.u8p   = utf8(),
+			.bytes = opt.m_bytes,
+			.chars = opt.m_chars,
+			.print = !opt.m_quiet && !opt.m_bytes && !opt.m_chars,
+			.skip  = opt.m_skip,
+		});
+
+	if (opt.m_quiet) {
+		struct utf8 u8p = utf8();
+		bool valid = true;
+		for (int i = 0; valid && i < letopt_nargs(&opt); ++i) {
+			uint8_t const *s = (uint8_t const *)letopt_arg(&opt, i);
+			size_t n = strlen((char const *)s);
+			valid = opt.m_join ? utf8_stream_feed(&u8p, s, n)
+			                   : utf8_validate(s, n);
+		}
+		if (!valid || (opt.m_join && !utf8_stream_finish(&u8p)))
+			opt.p.e = EILSEQ;
+		return letopt_fini(&opt);
+	}
+
 	struct uz2 sz = arg_sizes(&opt);
 	size_t buf_sz = opt.m_join ? sz.sum : sz.max;
 	buf_sz = saturated_add_uz(
@@ -121,40 +211,19 @@ main (int    c,
 
 	const bool count = opt.m_bytes || opt.m_chars;
 	const bool print = !opt.m_quiet && (opt.m_print || !count);
-	size_t n_chars = 0, n_bytes = 0;
-	struct utf8 u8p = utf8();
+	struct inspect in = {
+		.u8p   = utf8(),
+		.bytes = opt.m_bytes,
+		.chars = opt.m_chars,
+		.print = print,
+		.skip  = opt.m_skip,
+	};
 	char *out = buf;
 
 	for (int i = 0; i < letopt_nargs(&opt); ++i) {
 		uint8_t const *p = (uint8_t const *)letopt_arg(&opt, i);
-		for (uint8_t const *q = p; *q; q = p) {
-			p = utf8_parse_next_code_point(&u8p, q);
-			if (u8p.error) {
-				if (print &&
-				    !opt.m_skip && (*p || !opt.m_join)) {
-					*out++ = (char)(unsigned char)0xefU;
-					*out++ = (char)(unsigned char)0xbfU;
-					*out++ = (char)(unsigned char)0xbdU;
-				}
-				if (!*p)
-					break;
-				if (p == q && utf8_expects_leading_byte(&u8p))
-					++p;
-				utf8_reset(&u8p);
-				continue;
-			}
-
-			if (opt.m_bytes)
-				n_bytes += utf8_size(&u8p);
-			if (opt.m_chars)
-				n_chars += 1U;
-
-			if (print) {
-				for (char const *s = utf8_result(&u8p); *s;) {
-					*out++ = *s++;
-				}
-			}
-		}
+		out = inspect(&in, p, p + strlen((char const *)p), out,
+		              !opt.m_join);
 
 		if (!opt.m_join) {
 			if (print) {
@@ -167,23 +236,23 @@ main (int    c,
 					(void)fputs(buf, stdout);
 				else if (!opt.m_bytes || !opt.m_chars)
 					(void)printf("%zu\t%s", opt.m_bytes
-					             ? n_bytes : n_chars, buf);
+					             ? in.n_bytes : in.n_chars, buf);
 				else
-					(void)printf("%zu\t%zu\t%s", n_chars,
-					             n_bytes, buf);
+					(void)printf("%zu\t%zu\t%s", in.n_chars,
+					             in.n_bytes, buf);
 
 			} else if (count) {
 				if (!opt.m_bytes || !opt.m_chars)
 					(void)printf("%zu\n", opt.m_bytes
-					             ? n_bytes : n_chars);
+					             ? in.n_bytes : in.n_chars);
 				else
-					(void)printf("%zu\t%zu\n", n_chars,
-					             n_bytes);
+					(void)printf("%zu\t%zu\n", in.n_chars,
+					             in.n_bytes);
 			}
 
-			n_chars = 0;
-			n_bytes = 0;
-			utf8_reset(&u8p);
+			in.n_chars = 0;
+			in.n_bytes = 0;
+			utf8_reset(&in.u8p);
 		}
 	}
 
@@ -197,18 +266,18 @@ main (int    c,
 				(void)fputs(buf, stdout);
 			else if (!opt.m_bytes || !opt.m_chars)
 				(void)printf("%zu\t%s", opt.m_bytes
-				             ? n_bytes : n_chars, buf);
+				             ? in.n_bytes : in.n_chars, buf);
 			else
-				(void)printf("%zu\t%zu\t%s", n_chars,
-				             n_bytes, buf);
+				(void)printf("%zu\t%zu\t%s", in.n_chars,
+				             in.n_bytes, buf);
 
 		} else if (count) {
 			if (!opt.m_bytes || !opt.m_chars)
 				(void)printf("%zu\n", opt.m_bytes
-				             ? n_bytes : n_chars);
+				             ? in.n_bytes : in.n_chars);
 			else
-				(void)printf("%zu\t%zu\n", n_chars,
-				             n_bytes);
+				(void)printf("%zu\t%zu\n", in.n_chars,
+				             in.n_bytes);
 		}
 	}
 
@@ -216,16 +285,294 @@ main (int    c,
 	return letopt_fini(&opt);
 }
 
+/**
+ * @brief Get the number of bytes of an incomplete sequence consumed
+ *        into the parser state.
+ */
+static size_t
+pending (struct utf8 const *u8p)
+{
+	return utf8_expects_leading_byte(u8p)
+	       ? 0 : strnlen(utf8_result(u8p), sizeof u8p->cache - 1U);
+}
+
+/**
+ * @brief Inspect the bytes in `[p, end)`, appending printable output.
+ *
+ * Never reads past `end`; a sequence split at `end` is kept in `in`
+ * to be completed by the next call, unless `last` is set, in which
+ * case it is treated as invalid.
+ *
+ * @param in   Inspection state.
+ * @param p    First byte to inspect.
+ * @param end  One past the last byte to inspect.
+ * @param out  Output position, with room for `3 * (end - p) + 3` bytes.
+ * @param last Whether `end` is the end of the string.
+ * @return The new output position.
+ */
+static char *
+inspect (struct inspect *in,
+         uint8_t const  *p,
+         uint8_t const  *end,
+         char           *out,
+         bool            last)
+{
+	if (in->bytes || in->chars) {
+		for (uint8_t const *q = p; q < end;) {
+			size_t pre = pending(&in->u8p);
+			struct utf8_span s = utf8_validate_count(
+				&in->u8p, q, (size_t)(end - q));
+			in->n_chars += s.count;
+			in->n_bytes += pre + (size_t)(s.ptr - q)
+			               - pending(&in->u8p);
+			q = s.ptr;
+
+			if (in->u8p.error) {
+				if (utf8_expects_leading_byte(&in->u8p))
+					++q;
+				utf8_reset(&in->u8p);
+			}
+		}
+
+		if (last)
+			utf8_reset(&in->u8p);
+	}
+
+	if (!in->print)
+		return out;
+
+	unsigned flags = in->skip ? utf8_sanitize_skip : 0U;
+
+	// Finish the sequence left incomplete by the previous call
+	// with as few bytes as it takes
+	if (in->n_part) {
+		uint8_t buf[7];
+		size_t k = (size_t)(end - p);
+		if (k > 4U)
+			k = 4U;
+		(void)memcpy(buf, in->part, in->n_part);
+		(void)memcpy(&buf[in->n_part], p, k);
+
+		size_t n = in->n_part + k;
+		bool partial = !last || k < (size_t)(end - p);
+		struct utf8_conv r = utf8_sanitize(
+			(uint8_t *)out, 3U * n, buf, n,
+			flags | (partial ? utf8_sanitize_partial : 0U));
+		out += r.out;
+
+		if (r.in < in->n_part) {
+			// Still incomplete, so all of the input fit in
+			in->n_part = (uint8_t)(n - r.in);
+			(void)memmove(in->part, &buf[r.in], in->n_part);
+			return out;
+		}
+
+		p += r.in - in->n_part;
+		in->n_part = 0;
+	}
+
+	struct utf8_conv r = utf8_sanitize(
+		(uint8_t *)out, 3U * (size_t)(end - p), p, (size_t)(end - p),
+		flags | (last ? 0U : utf8_sanitize_partial));
+	out += r.out;
+
+	in->n_part = (uint8_t)((size_t)(end - p) - r.in);
+	(void)memcpy(in->part, &p[r.in], in->n_part);
+
+	return out;
+}
+
+/**
+ * @brief Inspect a span of file data, writing output as it goes.
+ *
+ * Output is produced through a fixed-size buffer, so memory use does
+ * not depend on the length of the span.
+ *
+ * @return `false` if the span is invalid in quiet mode, else `true`.
+ */
+static bool
+inspect_span (struct letopt  *opt,
+              struct inspect *in,
+              uint8_t const  *p,
+              size_t          n,
+              bool            last)
+{
+	static char buf[FILE_OUT_SIZE];
+
+	if (opt->m_quiet)
+		return utf8_stream_feed(&in->u8p, p, n)
+		       && (!last || utf8_stream_finish(&in->u8p));
+
+	do {
+		size_t k = (sizeof buf) / 3U - 1U;
+		if (k > n)
+			k = n;
+
+		char *out = inspect(in, p, p + k, buf, last && k == n);
+		if (out != buf) {
+			in->tail = out[-1];
+			(void)fwrite(buf, 1U, (size_t)(out - buf), stdout);
+		}
+
+		p += k;
+		n -= k;
+	} while (n);
+
+	return true;
+}
+
+/**
+ * @brief Inspect a memory-mapped file one window at a time.
+ *
+ * Inspected windows are dropped from the mapping so that resident
+ * memory stays bounded by the window size.
+ */
+static int
+inspect_map (struct letopt  *opt,
+             struct inspect *in,
+             uint8_t        *map,
+             size_t          size,
+             bool            last)
+{
+	(void)madvise(map, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+	(void)madvise(map, size, MADV_HUGEPAGE);
+#endif
+
+	for (size_t off = 0; off < size;) {
+		size_t n = size - off;
+		if (n > FILE_WINDOW_SIZE)
+			n = FILE_WINDOW_SIZE;
+
+		bool ok = inspect_span(opt, in, &map[off], n,
+		                       last && off + n == size);
+		(void)madvise(&map[off], n, MADV_DONTNEED);
+		if (!ok)
+			return EILSEQ;
+
+		off += n;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Inspect a file which can't be mapped, e.g. a pipe.
+ */
+static int
+inspect_read (struct letopt  *opt,
+              struct inspect *in,
+              int             fd,
+              bool            last)
+{
+	static uint8_t buf[FILE_READ_SIZE];
+
+	for (;;) {
+		ssize_t r = read(fd, buf, sizeof buf);
+		if (r < 0) {
+			if (errno == EINTR)
+				continue;
+			return errno;
+		}
+
+		if (!inspect_span(opt, in, buf, (size_t)r, last && !r))
+			return EILSEQ;
+
+		if (!r)
+			return 0;
+	}
+}
+
+static int
+inspect_file (struct letopt  *opt,
+              struct inspect *in,
+              char const     *path,
+              bool            last)
+{
+	bool std = !strcmp(path, "-");
+	int fd = std ? STDIN_FILENO : open(path, O_RDONLY | O_CLOEXEC);
+	int e = 0;
+
+	if (fd < 0) {
+		e = errno;
+		(void)fprintf(stderr, "error: %s: %s\n", path, strerror(e));
+		return e;
+	}
+
+	struct stat st;
+	if (!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0
+	    && (uintmax_t)st.st_size <= SIZE_MAX) {
+		size_t size = (size_t)st.st_size;
+		void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED) {
+			e = inspect_map(opt, in, map, size, last);
+			(void)munmap(map, size);
+			goto done;
+		}
+	}
+
+	e = inspect_read(opt, in, fd, last);
+	if (e && e != EILSEQ)
+		(void)fprintf(stderr, "error: %s: %s\n", path, strerror(e));
+
+done:
+	if (!std)
+		(void)close(fd);
+
+	return e;
+}
+
+static int
+inspect_files (struct letopt  *opt,
+               struct inspect *in)
+{
+	const int n = letopt_nargs(opt);
+	int e = 0;
+
+	for (int i = 0; !e && i < n; ++i) {
+		const bool last = !opt->m_join || i == n - 1;
+
+		e = inspect_file(opt, in, letopt_arg(opt, i), last);
+		if (e || !last)
+			continue;
+
+		if (in->print) {
+			if (in->tail != '\n')
+				(void)putchar('\n');
+			in->tail = '\0';
+
+		} else if (in->bytes != in->chars) {
+			(void)printf("%zu\n", in->bytes ? in->n_bytes
+			                                 : in->n_chars);
+		} else if (in->bytes) {
+			(void)printf("%zu\t%zu\n", in->n_chars, in->n_bytes);
+		}
+
+		in->n_chars = 0;
+		in->n_bytes = 0;
+		utf8_reset(&in->u8p);
+	}
+
+	opt->p.e = e;
+	return letopt_fini(opt);
+}
+
 static int
 arg_conflict (struct letopt *opt)
 {
 	bool count = opt->m_bytes || opt->m_chars;
 	int e = 0;
 
-	if (opt->m_graph && (letopt_nargs(opt) > 0 || count
+#ifdef UTF8_PROFILE
+	bool args = false;
+#else /* UTF8_PROFILE */
+	bool args = letopt_nargs(opt) > 0;
+#endif /* UTF8_PROFILE */
+
+	if (opt->m_graph && (args || count
 	                     || opt->m_help || opt->m_print
 	                     || opt->m_join || opt->m_quiet
-	                     || opt->m_skip)) {
+	                     || opt->m_skip || opt->m_width)) {
 		(void)fputs("error: graph dump option is exclusive\n",
 		            stderr);
 		e = EINVAL;
@@ -245,6 +592,19 @@ arg_conflict (struct letopt *opt)
 			}
 		}
 
+		if (opt->m_width && (count || opt->m_file || opt->m_join
+		                     || opt->m_quiet || opt->m_skip)) {
+			(void)fputs("error: width only combines with print\n",
+			            stderr);
+			e = EINVAL;
+		}
+
+		if (opt->m_file && count && opt->m_print) {
+			(void)fputs("error: can't count and print files\n",
+			            stderr);
+			e = EINVAL;
+		}
+
 		if (opt->m_skip &&
 		    (opt->m_quiet || (!opt->m_print && count)))
 			(void)fputs("warning: skip option ignored\n", stderr);
@@ -257,6 +617,39 @@ arg_conflict (struct letopt *opt)
 static int
 dump_utf8_graph (struct letopt *opt)
 {
+#ifdef UTF8_PROFILE
+	if (letopt_nargs(opt) > 0) {
+		static char buf[8192] = {0};
+		struct utf8_profile prof;
+
+		utf8_profile_reset();
+		for (int i = 0; i < letopt_nargs(opt); ++i) {
+			uint8_t const *p = (uint8_t const *)letopt_arg(opt, i);
+			uint8_t const *end = p + strlen((char const *)p);
+			struct utf8 u8p = utf8();
+			while (p < end) {
+				p = utf8_parse_span(&u8p, p, end).ptr;
+				if (u8p.error) {
+					if (utf8_expects_leading_byte(&u8p))
+						++p;
+					utf8_reset(&u8p);
+				}
+			}
+		}
+		utf8_profile_get(&prof);
+
+		char const *end = utf8_graph_profile(buf, &buf[sizeof buf],
+		                                     &prof, &opt->p.e);
+		if (end)
+			(void)fputs(buf, stdout);
+		else if (opt->p.e)
+			(void)fprintf(stderr, "error: utf8_graph_profile: %s\n",
+			              strerror(opt->p.e));
+
+		return letopt_fini(opt);
+	}
+#endif /* UTF8_PROFILE */
+
 	static char buf[1024] = {0};
 	char const *end = utf8_graph(buf, &buf[sizeof buf], &opt->p.e);
 
@@ -268,3 +661,25 @@ dump_utf8_graph (struct letopt *opt)
 
 	return letopt_fini(opt);
 }
+
+static int
+print_widths (struct letopt *opt)
+{
+	for (int i = 0; i < letopt_nargs(opt); ++i) {
+		char const *s = letopt_arg(opt, i);
+		struct utf8_width w = utf8_display_width((uint8_t const *)s,
+		                                         strlen(s));
+		if (w.error) {
+			(void)fprintf(stderr, "error: invalid UTF-8 at byte %zu"
+			              " of argument %d\n", w.offset, i + 1);
+			opt->p.e = w.error;
+		}
+
+		if (opt->m_print)
+			(void)printf("%zu\t%s\n", w.width, s);
+		else
+			(void)printf("%zu\n", w.width);
+	}
+
+	return letopt_fini(opt);
+}
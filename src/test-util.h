@@ -0,0 +1,182 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file test-util.h
+ * @brief Random input generation shared by the test programs.
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef CUTF8_SRC_TEST_UTIL_H_
+#define CUTF8_SRC_TEST_UTIL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utf8.h"
+
+/**
+ * @brief SplitMix64, so that the tests don't depend on the libc.
+ */
+static inline uint32_t
+rnd (uint64_t *const s)
+{
+	uint64_t z = (*s += UINT64_C(0x9e3779b97f4a7c15));
+	z = (z ^ (z >> 30U)) * UINT64_C(0xbf58476d1ce4e5b9);
+	z = (z ^ (z >> 27U)) * UINT64_C(0x94d049bb133111eb);
+	return (uint32_t)((z ^ (z >> 31U)) >> 32U);
+}
+
+/** @brief A random number below `n`, which must not be 0. */
+static inline size_t
+rnd_below (uint64_t *const s,
+           size_t          n)
+{
+	return (size_t)(((uint64_t)rnd(s) << 32U | rnd(s)) % n);
+}
+
+/**
+ * @brief Encode a Unicode scalar value as UTF-8 the slow way, without
+ *        the library.
+ *
+ * @return The number of bytes written, 1 to 4.
+ */
+static inline size_t
+put_utf8 (uint8_t *const dst,
+          uint32_t       cp)
+{
+	if (cp < 0x80U) {
+		dst[0] = (uint8_t)cp;
+		return 1U;
+	}
+
+	if (cp < 0x800U) {
+		dst[0] = (uint8_t)(0xc0U | cp >> 6U);
+		dst[1] = (uint8_t)(0x80U | (cp & 0x3fU));
+		return 2U;
+	}
+
+	if (cp < 0x10000U) {
+		dst[0] = (uint8_t)(0xe0U | cp >> 12U);
+		dst[1] = (uint8_t)(0x80U | (cp >> 6U & 0x3fU));
+		dst[2] = (uint8_t)(0x80U | (cp & 0x3fU));
+		return 3U;
+	}
+
+	dst[0] = (uint8_t)(0xf0U | cp >> 18U);
+	dst[1] = (uint8_t)(0x80U | (cp >> 12U & 0x3fU));
+	dst[2] = (uint8_t)(0x80U | (cp >> 6U & 0x3fU));
+	dst[3] = (uint8_t)(0x80U | (cp & 0x3fU));
+	return 4U;
+}
+
+/**
+ * @brief A random Unicode scalar value, mostly ASCII, with every
+ *        sequence length and the edges of each length range.
+ */
+static inline uint32_t
+rnd_cp (uint64_t *const s)
+{
+	static uint32_t const edge[] = {
+		0x00U, 0x7fU, 0x80U, 0x7ffU, 0x800U, 0xfffU, 0x1000U,
+		0xd7ffU, 0xe000U, 0xfffdU, 0xffffU, 0x10000U, 0x3ffffU,
+		0x40000U, 0xfffffU, 0x100000U, 0x10ffffU,
+	};
+
+	uint32_t r = rnd(s) % 100U;
+	if (r < 50U)
+		return 0x20U + rnd(s) % 0x5fU;
+	if (r < 55U)
+		return edge[rnd(s) % (sizeof edge / sizeof *edge)];
+	if (r < 70U)
+		return 0x80U + rnd(s) % 0x780U;
+	if (r < 90U) {
+		uint32_t cp = 0x800U + rnd(s) % 0xf800U;
+		return (cp & ~0x7ffU) == 0xd800U ? 0xfffdU : cp;
+	}
+	return 0x10000U + rnd(s) % 0x100000U;
+}
+
+/** Byte sequences which are invalid, or valid only at the edges. */
+static char const *const test_snippet[] = {
+	"\xc0\xaf", "\xc1\xbf", "\xc2", "\xdf\xbf", "\xe0\x80\x80",
+	"\xe0\x9f\xbf", "\xe0\xa0\x80", "\xed\x9f\xbf", "\xed\xa0\x80",
+	"\xed\xbf\xbf", "\xee\x80", "\xef\xbf\xbf", "\xf0\x80\x80\x80",
+	"\xf0\x8f\xbf\xbf", "\xf0\x90\x80\x80", "\xf4\x8f\xbf\xbf",
+	"\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "\x80", "\xbf",
+	"\xe2\x82", "\xf0\x9f\x98", "\xe2\x28\xa1", "\xf1\x80\x80\xc0",
+};
+
+/**
+ * @brief Fill a buffer with test input.
+ *
+ * Random bytes, valid UTF-8, valid UTF-8 corrupted in a few places
+ * with random bytes and with @ref test_snippet sequences, or valid
+ * UTF-8 cut short at the end, picked at random.
+ */
+static inline void
+test_fill (uint8_t *const  buf,
+           size_t          len,
+           uint64_t *const s)
+{
+	uint32_t mode = rnd(s) % 8U;
+	size_t n = 0;
+
+	if (!mode) {
+		for (; n < len; ++n)
+			buf[n] = (uint8_t)rnd(s);
+		return;
+	}
+
+	while (len - n >= 4U)
+		n += put_utf8(&buf[n], rnd_cp(s));
+	(void)memset(&buf[n], 'a', len - n);
+
+	if (mode < 4U || !len)
+		return;
+
+	if (mode == 7U) {
+		// Cut the last sequence short
+		uint8_t t[4];
+		size_t k = put_utf8(t, 0x80U + rnd(s) % 0x10ff80U);
+		size_t c = 1U + rnd_below(s, k - 1U);
+		if (c <= len)
+			(void)memcpy(&buf[len - c], t, c);
+		return;
+	}
+
+	for (size_t i = 1U + rnd(s) % (mode == 6U ? 64U : 3U); i; --i) {
+		if (rnd(s) % 2U) {
+			buf[rnd_below(s, len)] = (uint8_t)rnd(s);
+			continue;
+		}
+		char const *t = test_snippet[rnd(s) % (sizeof test_snippet
+		                                       / sizeof *test_snippet)];
+		size_t k = strlen(t);
+		if (k <= len)
+			(void)memcpy(&buf[rnd_below(s, len - k + 1U)], t, k);
+	}
+}
+
+/**
+ * @brief Check whether the kernel asked for with `UTF8_KERNEL` is
+ *        in use.
+ *
+ * The kernel can only be picked once per process, and the level
+ * asked for isn't used if the CPU can't run it.
+ *
+ * @return `true` if the program should skip its tests.
+ */
+static inline bool
+test_skip (char const *const argv0)
+{
+	char const *env = getenv("UTF8_KERNEL");
+	if (env && strcmp(env, utf8_kernel())) {
+		(void)fprintf(stderr, "%s: kernel %s not available, skipping\n",
+		              argv0, env);
+		return true;
+	}
+
+	return false;
+}
+
+#endif /* CUTF8_SRC_TEST_UTIL_H_ */
@@ -0,0 +1,481 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file test-validate.c
+ *
+ * @brief Differential tests of the bulk validators, decoders and
+ *        sanitizer against the scalar state machine.
+ *
+ * Generates random, valid, corrupted and truncated input, and checks
+ * that @ref utf8_validate(), @ref utf8_check(), @ref utf8_validate_batch(),
+ * @ref utf8_validate_count(), @ref utf8_count_code_points(), the stream
+ * validator, @ref utf8_validate_mt(), the UTF-32 and UTF-16 decoders and
+ * @ref utf8_sanitize() all agree with a reference which looks at one
+ * sequence at a time with @ref utf8_parse_span(). The vector kernel is
+ * picked as usual, so `make check` runs the program once per value of
+ * the `UTF8_KERNEL` environment variable.
+ *
+ * @author Juuso Alasuutari
+ */
+#include <errno.h>
+
+#include "test-util.h"
+
+/** Longest input of the single buffer tests. */
+#define TEST_LEN_MAX 70000U
+
+/** Input size of the multi-threaded validation tests. */
+#define TEST_MT_LEN (5U << 20U)
+
+/** The replacement character U+FFFD in UTF-8. */
+static uint8_t const test_fffd[] = {0xefU, 0xbfU, 0xbdU};
+
+/**
+ * @brief One sequence of the input as the reference sees it.
+ */
+struct ref {
+	/** @brief Bytes the sequence takes: its length if valid, otherwise
+	 *         the maximal subpart replaced by one U+FFFD. */
+	size_t                len;
+	/** @brief The code point if valid. */
+	uint32_t              cp;
+	/** @brief Why the sequence is invalid, or @ref utf8_valid. */
+	enum utf8_error_class error;
+};
+
+/**
+ * @brief Classify an invalid sequence the way the error classes are
+ *        documented.
+ *
+ * @param p The sequence.
+ * @param f The index of the first byte which can't be part of it.
+ */
+static enum utf8_error_class
+ref_class (uint8_t const *const p,
+           size_t               f)
+{
+	uint8_t b0 = p[0];
+
+	if (!f)
+		return b0 < 0xc0U ? utf8_stray_continuation
+		     : b0 < 0xc2U ? utf8_overlong
+		     :              utf8_too_large;
+
+	if (f == 1U && p[1] >= 0x80U && p[1] < 0xc0U) {
+		uint8_t b1 = p[1];
+		if ((b0 == 0xe0U && b1 < 0xa0U) || (b0 == 0xf0U && b1 < 0x90U))
+			return utf8_overlong;
+		if (b0 == 0xedU && b1 >= 0xa0U)
+			return utf8_surrogate;
+		if (b0 == 0xf4U && b1 >= 0x90U)
+			return utf8_too_large;
+	}
+
+	return utf8_missing_continuation;
+}
+
+/**
+ * @brief Look at the sequence at `buf[i]`, `i < len`, by feeding the
+ *        scalar parser one more byte at a time until it completes a
+ *        code point, rejects a byte, or runs out of input.
+ */
+static struct ref
+ref_next (uint8_t const *const buf,
+          size_t               i,
+          size_t               len)
+{
+	for (size_t k = 1U; k <= 4U && i + k <= len; ++k) {
+		struct utf8 u8p = utf8();
+		struct utf8_span sp = utf8_parse_span(&u8p, &buf[i], &buf[i + k]);
+
+		if (u8p.error) {
+			size_t f = (size_t)(sp.ptr - &buf[i]);
+			return (struct ref){
+				.len   = f ? f : 1U,
+				.error = ref_class(&buf[i], f),
+			};
+		}
+
+		if (sp.count) {
+			uint32_t cp = k == 1U ? buf[i] : buf[i] & (0x7fU >> k);
+			for (size_t j = 1U; j < k; ++j)
+				cp = cp << 6U | (buf[i + j] & 0x3fU);
+			return (struct ref){.len = k, .cp = cp};
+		}
+	}
+
+	return (struct ref){
+		.len   = len - i,
+		.error = utf8_truncated,
+	};
+}
+
+/** The failures so far. */
+static unsigned test_failed;
+
+/** The seed of the current input, for reproducing a failure. */
+static uint64_t test_seed;
+
+/**
+ * @brief Report a failed check.
+ */
+#define expect(cond, ...) do {                                        \
+	if (!(cond)) {                                                \
+		(void)fprintf(stderr, "seed %#llx: %s: ",             \
+		              (unsigned long long)test_seed, #cond);  \
+		(void)fprintf(stderr, __VA_ARGS__);                   \
+		(void)fputc('\n', stderr);                            \
+		++test_failed;                                        \
+	}                                                             \
+} while (0)
+
+/**
+ * @brief Compare two parser objects.
+ */
+static bool
+same_state (struct utf8 const *const a,
+            struct utf8 const *const b)
+{
+	return a->state == b->state && a->error == b->error
+	    && !memcmp(a->cache, b->cache, sizeof a->cache);
+}
+
+/**
+ * @brief Test @ref utf8_check() and @ref utf8_validate().
+ */
+static void
+test_check (uint8_t const *const buf,
+            size_t               len)
+{
+	size_t i = 0;
+	struct ref r = {0};
+
+	for (; i < len; i += r.len) {
+		r = ref_next(buf, i, len);
+		if (r.error)
+			break;
+	}
+
+	struct utf8_check c = utf8_check(buf, len);
+	expect(c.offset == i && c.error == (i < len ? r.error : utf8_valid),
+	       "len %zu: got %zu/%d, want %zu/%d", len, c.offset,
+	       (int)c.error, i, i < len ? (int)r.error : 0);
+	expect(utf8_validate(buf, len) == (i == len), "len %zu", len);
+}
+
+/**
+ * @brief Test @ref utf8_validate_count() and
+ *        @ref utf8_count_code_points() against @ref utf8_parse_span(),
+ *        on the whole buffer and on consecutive spans of it.
+ */
+static void
+test_count (uint8_t const *const buf,
+            size_t               len,
+            uint64_t *const      s)
+{
+	size_t leading = 0;
+	for (size_t i = 0; i < len; ++i)
+		leading += (int8_t)buf[i] >= -0x40;
+	expect(utf8_count_code_points(buf, len) == leading, "len %zu", len);
+
+	struct utf8 a = utf8(), b = utf8();
+	for (size_t i = 0; i < len;) {
+		size_t n = rnd(s) % 4U ? len - i : rnd_below(s, len - i + 1U);
+		struct utf8_span x = utf8_validate_count(&a, &buf[i], n);
+		struct utf8_span y = utf8_parse_span(&b, &buf[i], &buf[i + n]);
+		expect(x.ptr == y.ptr && x.count == y.count
+		       && same_state(&a, &b),
+		       "span %zu+%zu: got %td/%zu, want %td/%zu", i, n,
+		       x.ptr - buf, x.count, y.ptr - buf, y.count);
+		if (b.error || x.ptr != y.ptr)
+			break;
+		i += n;
+	}
+}
+
+/**
+ * @brief Test @ref utf8_stream_feed() and @ref utf8_stream_finish()
+ *        with the input split into random chunks.
+ */
+static void
+test_stream (uint8_t const *const buf,
+             size_t               len,
+             uint64_t *const      s)
+{
+	struct utf8 ref = utf8();
+	struct utf8_span sp = utf8_parse_span(&ref, buf, buf + len);
+	size_t bad = ref.error ? (size_t)(sp.ptr - buf) : len;
+	bool valid = !ref.error && utf8_expects_leading_byte(&ref);
+
+	struct utf8 u8p = utf8();
+	for (size_t i = 0; i < len;) {
+		size_t n = 1U + rnd_below(s, rnd(s) % 2U ? len - i : 5U);
+		if (n > len - i)
+			n = len - i;
+		bool ok = utf8_stream_feed(&u8p, &buf[i], n);
+		i += n;
+		expect(ok == (bad >= i), "chunk ending at %zu, error at %zu",
+		       i, bad);
+	}
+
+	expect(utf8_stream_finish(&u8p) == valid, "len %zu", len);
+}
+
+/** Output space of the decoders, in code units. */
+static uint32_t test_out32[TEST_LEN_MAX];
+static uint16_t test_out16[TEST_LEN_MAX];
+
+/** Expected output of the decoders. */
+static uint32_t test_ref32[TEST_LEN_MAX];
+static uint16_t test_ref16[TEST_LEN_MAX];
+
+/**
+ * @brief Test @ref utf8_to_utf32(), @ref utf8_to_utf16le() and
+ *        @ref utf8_to_utf16be() with both policies.
+ */
+static void
+test_decode (uint8_t const *const buf,
+             size_t               len)
+{
+	for (unsigned p = utf8_stop; p <= utf8_replace; ++p) {
+		size_t in = 0, n32 = 0, n16 = 0;
+		int error = 0;
+
+		for (struct ref r; in < len; in += r.len) {
+			r = ref_next(buf, in, len);
+			uint32_t cp = r.cp;
+			if (r.error) {
+				error = EILSEQ;
+				if (p == utf8_stop)
+					break;
+				cp = 0xfffdU;
+			}
+			test_ref32[n32++] = cp;
+			if (cp > 0xffffU) {
+				test_ref16[n16++] = (uint16_t)(0xd7c0U + (cp >> 10U));
+				test_ref16[n16++] = (uint16_t)(0xdc00U | (cp & 0x3ffU));
+			} else {
+				test_ref16[n16++] = (uint16_t)cp;
+			}
+		}
+
+		struct utf8_conv c = utf8_to_utf32(test_out32, buf, len,
+		                                   (enum utf8_policy)p);
+		expect(c.in == in && c.out == n32 && c.error == error
+		       && !memcmp(test_out32, test_ref32, n32 * sizeof *test_ref32),
+		       "utf32 policy %u: got %zu/%zu/%d, want %zu/%zu/%d",
+		       p, c.in, c.out, c.error, in, n32, error);
+
+		c = utf8_to_utf16le(test_out16, buf, len, (enum utf8_policy)p);
+		expect(c.in == in && c.out == n16 && c.error == error
+		       && !memcmp(test_out16, test_ref16, n16 * sizeof *test_ref16),
+		       "utf16le policy %u: got %zu/%zu/%d, want %zu/%zu/%d",
+		       p, c.in, c.out, c.error, in, n16, error);
+
+		for (size_t i = 0; i < n16; ++i)
+			test_ref16[i] = (uint16_t)(test_ref16[i] >> 8U
+			                           | test_ref16[i] << 8U);
+		c = utf8_to_utf16be(test_out16, buf, len, (enum utf8_policy)p);
+		expect(c.in == in && c.out == n16 && c.error == error
+		       && !memcmp(test_out16, test_ref16, n16 * sizeof *test_ref16),
+		       "utf16be policy %u: got %zu/%zu/%d, want %zu/%zu/%d",
+		       p, c.in, c.out, c.error, in, n16, error);
+	}
+}
+
+/** Output space of the sanitizer, with room for a canary. */
+static uint8_t test_out8[3U * TEST_LEN_MAX + 1U];
+
+/** Expected output of the sanitizer. */
+static uint8_t test_ref8[3U * TEST_LEN_MAX];
+
+/**
+ * @brief Test @ref utf8_sanitize() and @ref utf8_sanitized_size() with
+ *        every combination of flags, with enough room and without.
+ */
+static void
+test_sanitize (uint8_t const *const buf,
+               size_t               len,
+               uint64_t *const      s)
+{
+	for (unsigned f = 0; f < 4U; ++f) {
+		bool const skip = f & utf8_sanitize_skip;
+		bool const partial = f & utf8_sanitize_partial;
+		size_t in = 0, out = 0;
+		int error = 0;
+
+		// Output is cut after whole sequences; `cut` is the input
+		// and output consumed so far when `cap` bytes don't fit
+		size_t cap = rnd(s) % 2U ? SIZE_MAX : rnd_below(s, 3U * len + 1U);
+		size_t cut_lo = 0, cut_hi = SIZE_MAX, cut_out = 0;
+
+		for (struct ref r; in < len; in += r.len) {
+			r = ref_next(buf, in, len);
+			if (r.error == utf8_truncated && partial)
+				break;
+
+			uint8_t const *src = &buf[in];
+			size_t n = r.len;
+			if (r.error) {
+				error = EILSEQ;
+				src = test_fffd;
+				n = skip ? 0 : sizeof test_fffd;
+			}
+
+			if (cut_hi == SIZE_MAX) {
+				if (out + n > cap)
+					cut_hi = in;
+				else if (n) {
+					cut_lo = in + r.len;
+					cut_out = out + n;
+				}
+			}
+
+			(void)memcpy(&test_ref8[out], src, n);
+			out += n;
+		}
+
+		expect(utf8_sanitized_size(buf, len, f) == out,
+		       "flags %u: want %zu", f, out);
+
+		if (cut_hi == SIZE_MAX) {
+			struct utf8_conv c = utf8_sanitize(test_out8, out, buf,
+			                                   len, f);
+			expect(c.in == in && c.out == out && c.error == error
+			       && !memcmp(test_out8, test_ref8, out),
+			       "flags %u: got %zu/%zu/%d, want %zu/%zu/%d", f,
+			       c.in, c.out, c.error, in, out, error);
+			continue;
+		}
+
+		test_out8[cap] = 0x5aU;
+		struct utf8_conv c = utf8_sanitize(test_out8, cap, buf, len, f);
+		expect(c.in >= cut_lo && c.in <= cut_hi && c.out == cut_out
+		       && c.error == E2BIG && test_out8[cap] == 0x5aU
+		       && !memcmp(test_out8, test_ref8, cut_out),
+		       "flags %u cap %zu: got %zu/%zu/%d, want %zu-%zu/%zu/E2BIG",
+		       f, cap, c.in, c.out, c.error, cut_lo, cut_hi, cut_out);
+	}
+}
+
+/** Most strings per batch. */
+#define TEST_BATCH_MAX 200U
+
+/**
+ * @brief Test @ref utf8_validate_batch() against @ref utf8_check(),
+ *        which @ref test_check() tests against the reference.
+ */
+static void
+test_batch (uint8_t *const  buf,
+            uint64_t *const s)
+{
+	static uint8_t const *ptrs[TEST_BATCH_MAX];
+	static size_t lens[TEST_BATCH_MAX];
+	static struct utf8_check res[TEST_BATCH_MAX];
+
+	size_t n = rnd_below(s, TEST_BATCH_MAX + 1U), off = 0, valid = 0;
+	for (size_t i = 0; i < n; ++i) {
+		size_t len = rnd(s) % 16U ? rnd_below(s, 257U)
+		                          : rnd_below(s, 2000U);
+		test_fill(&buf[off], len, s);
+		ptrs[i] = &buf[off];
+		lens[i] = len;
+		off += len;
+	}
+
+	size_t got = utf8_validate_batch(ptrs, lens, n, res);
+	for (size_t i = 0; i < n; ++i) {
+		struct utf8_check c = utf8_check(ptrs[i], lens[i]);
+		valid += c.error == utf8_valid;
+		expect(res[i].offset == c.offset && res[i].error == c.error,
+		       "string %zu of %zu: got %zu/%d, want %zu/%d", i, n,
+		       res[i].offset, (int)res[i].error, c.offset,
+		       (int)c.error);
+	}
+	expect(got == valid, "got %zu, want %zu", got, valid);
+}
+
+/**
+ * @brief Test @ref utf8_validate_mt() against @ref utf8_parse_span()
+ *        on input large enough to be split, with errors near the
+ *        split points, and starting in the middle of a sequence.
+ */
+static void
+test_mt (uint8_t *const  buf,
+         uint64_t *const s)
+{
+	size_t const len = TEST_MT_LEN - rnd_below(s, 1U << 16U);
+	unsigned const nthreads = 2U + rnd(s) % 4U;
+	size_t n = 0;
+
+	while (len - n >= 4U)
+		n += put_utf8(&buf[n], rnd_cp(s));
+	(void)memset(&buf[n], 'a', len - n);
+
+	for (unsigned i = rnd(s) % 3U; i; --i) {
+		size_t at = len / nthreads * (1U + rnd(s) % (nthreads - 1U));
+		at += rnd_below(s, 9U) - 4U;
+		char const *t = test_snippet[rnd(s) % (sizeof test_snippet
+		                                       / sizeof *test_snippet)];
+		(void)memcpy(&buf[at], t, strlen(t));
+	}
+
+	// Start after the first byte of a multi-byte sequence, and hand
+	// the first byte to the parser state beforehand
+	struct utf8 a = utf8();
+	size_t beg = 0;
+	if (rnd(s) % 2U) {
+		buf[0] = 0xe2U;
+		buf[1] = 0x82U;
+		buf[2] = 0xacU;
+		(void)utf8_parse_span(&a, buf, buf + 1);
+		beg = 1U;
+	}
+
+	struct utf8 b = a;
+	struct utf8_span x = utf8_validate_mt(&a, &buf[beg], len - beg, nthreads);
+	struct utf8_span y = utf8_parse_span(&b, &buf[beg], &buf[len]);
+	expect(x.ptr == y.ptr && x.count == y.count && same_state(&a, &b),
+	       "%u threads: got %td/%zu, want %td/%zu", nthreads,
+	       x.ptr - buf, x.count, y.ptr - buf, y.count);
+}
+
+int
+main (int    c,
+      char **v)
+{
+	(void)c;
+
+	if (test_skip(v[0]))
+		return EXIT_SUCCESS;
+
+	uint8_t *buf = malloc(TEST_MT_LEN);
+	if (!buf) {
+		(void)fprintf(stderr, "%s: %s\n", v[0], strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	for (unsigned i = 0; i < 3000U && test_failed < 20U; ++i) {
+		uint64_t s = test_seed = UINT64_C(0x7e57) + i;
+		uint32_t r = rnd(&s) % 100U;
+		size_t len = r < 70U ? rnd_below(&s, 300U)
+		           : r < 97U ? rnd_below(&s, 10000U)
+		           :           rnd_below(&s, TEST_LEN_MAX + 1U);
+
+		test_fill(buf, len, &s);
+		test_check(buf, len);
+		test_count(buf, len, &s);
+		test_stream(buf, len, &s);
+		test_decode(buf, len);
+		test_sanitize(buf, len, &s);
+		test_batch(buf, &s);
+	}
+
+	for (unsigned i = 0; i < 8U && test_failed < 20U; ++i) {
+		uint64_t s = test_seed = UINT64_C(0x3ead) + i;
+		test_mt(buf, &s);
+	}
+
+	free(buf);
+	(void)printf("kernel %s: %u failed\n", utf8_kernel(), test_failed);
+
+	return test_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
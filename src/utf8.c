@@ -13,102 +13,87 @@
 #include <assert.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <threads.h>
 
 #include "utf8_impl.h"
+#include "utf8_lut.h"
 
-#ifdef DEBUG
-utf8_const_inline char const *
-utf8_st8_name (enum utf8_st8 st8)
-{
-	constexpr static char const name[][8] = {
-		//! @cond
-		#define F(n,m,...) [n] = #m,
-		//! @endcond
-		UTF8_PARSER_DESCRIPTOR(F)
-		//! @cond
-		#undef F
-		//! @endcond
-	};
+/**
+ * @brief Sequence length for each parser state, indexed by state
+ *        enumeration.
+ */
+constexpr static const uint8_t utf8_len[16] = {
+	//! @cond
+	#define F(n,m,l,...) [n] = l,
+	//! @endcond
+	UTF8_PARSER_DESCRIPTOR(F)
+	//! @cond
+	#undef F
+	//! @endcond
+};
 
-	if (!is_negative(st8) && st8 < array_size(name))
-		return name[st8];
+#ifdef UTF8_PROFILE
+/** @brief The calling thread's profiling counters. */
+static thread_local struct utf8_profile utf8_prof;
 
-	return nullptr;
+/**
+ * @brief Count a state transition.
+ *
+ * @param from The state before the byte.
+ * @param to   The state after the byte.
+ * @param len  The length of the sequence if the byte completes one,
+ *             otherwise 0.
+ */
+utf8_force_inline void
+utf8_prof_step (unsigned from,
+                unsigned to,
+                unsigned len)
+{
+	from = from == utf8_ini ? utf8_asc : from;
+	++utf8_prof.transitions[from & 0xfU][to & 0xfU];
+	if (len)
+		utf8_prof.bytes[(len - 1U) & 3U] += len;
 }
-#endif /* DEBUG */
 
-//! @cond
-
-#define X1(x)   x
-#define X2(x)   x,x
-#define X3(x)   x,x,x
-#define X8(x)   x,x,x,x,x,x,x,x
-#define X11(x)  X8(x),x,x,x
-#define X12(x)  X11(x),x
-#define X16(x)  X8(x),X8(x)
-#define X30(x)  X16(x),X12(x),x,x
-#define X32(x)  X16(x),X16(x)
-#define X128(x) X32(x),X32(x),X32(x),X32(x)
-#define X(n, x) X##n(x)
-
-//! @endcond
-
-/** @brief Lookup table
- * @showinitializer
+/**
+ * @brief Count a run of `n` ASCII bytes entered from state `from`.
  */
-constexpr static const uint16_t utf8_lut[] = {
-	X(128,utf8_bit(asc)  ), /* 0x00-0x7f */
-
-	/* 0x80-0x8f */
-	X(16,utf8_bit(cb3)   \
-	    |utf8_bit(cb3_f4)\
-	    |utf8_bit(cb2)   \
-	    |utf8_bit(cb2_ed)\
-	    |utf8_bit(cb1)   ),
-
-	/* 0x90-0x9f */
-	X(16,utf8_bit(cb3)   \
-	    |utf8_bit(cb3_f0)\
-	    |utf8_bit(cb2)   \
-	    |utf8_bit(cb2_ed)\
-	    |utf8_bit(cb1)   ),
-
-	/* 0xa0-0xbf */
-	X(32,utf8_bit(cb3)   \
-	    |utf8_bit(cb3_f0)\
-	    |utf8_bit(cb2)   \
-	    |utf8_bit(cb2_e0)\
-	    |utf8_bit(cb1)   ),
-
-	X( 2,0               ), /* 0xc0-0xc1 */
-	X(30,utf8_bit(lb2)   ), /* 0xc2-0xdf */
-	X( 1,utf8_bit(lb3_e0)), /* 0xe0      */
-	X(12,utf8_bit(lb3)   ), /* 0xe1-0xec */
-	X( 1,utf8_bit(lb3_ed)), /* 0xed      */
-	X( 2,utf8_bit(lb3)   ), /* 0xee-0xef */
-	X( 1,utf8_bit(lb4_f0)), /* 0xf0      */
-	X( 3,utf8_bit(lb4)   ), /* 0xf1-0xf3 */
-	X( 1,utf8_bit(lb4_f4)), /* 0xf4      */
-	X(11,0               ), /* 0xf5-0xff */
-};
-
-//! @cond
+utf8_force_inline void
+utf8_prof_run (unsigned from,
+               size_t   n)
+{
+	from = from == utf8_ini ? utf8_asc : from;
+	++utf8_prof.transitions[from & 0xfU][utf8_asc];
+	utf8_prof.transitions[utf8_asc][utf8_asc] += n - 1U;
+	utf8_prof.bytes[0] += n;
+}
 
-#undef X
-#undef X128
-#undef X32
-#undef X30
-#undef X16
-#undef X12
-#undef X11
-#undef X8
-#undef X3
-#undef X2
-#undef X1
+/**
+ * @brief Count a byte rejected in state `from`.
+ */
+utf8_force_inline void
+utf8_prof_error (unsigned from)
+{
+	from = from == utf8_ini ? utf8_asc : from;
+	++utf8_prof.errors[from & 0xfU];
+}
 
-//! @endcond
+void
+utf8_profile_get (struct utf8_profile *const dst)
+{
+	*dst = utf8_prof;
+}
 
-constexpr static const UTF8_PARSER_STATE_MAP(utf8_dst);
+void
+utf8_profile_reset (void)
+{
+	utf8_prof = (struct utf8_profile){0};
+}
+#else /* UTF8_PROFILE */
+# define utf8_prof_step(...)
+# define utf8_prof_run(...)
+# define utf8_prof_error(...)
+#endif /* UTF8_PROFILE */
 
 /**
  * @brief Convert a parser state from a bit flag representation
@@ -234,47 +219,18 @@ utf8_push_to_cache (struct utf8 *const u8p,
                     enum utf8_st8      st8,
                     uint8_t            byte)
 {
-	constexpr static const uint8_t utf8_len[16] = {
-		//! @cond
-		#define F(n,m,l,...) [n] = l,
-		//! @endcond
-		UTF8_PARSER_DESCRIPTOR(F)
-		//! @cond
-		#undef F
-		//! @endcond
-	};
-
 	uint8_t len = utf8_len[st8];
-#ifdef DEBUG
-	uint8_t k = 0;
-#endif /* DEBUG */
 
 	if (utf8_st8_is_leading_byte(st8)) {
 		// Leading byte or ASCII
 		u8p->cache[0] = len;
 		__builtin_memset(&u8p->cache[1], 0, sizeof u8p->cache - 1U);
-		pr_(" [\033[1;3%" PRIu8 "m%02" PRIx8 "\033[m]", len, len);
-#ifdef DEBUG
-		++k;
-#endif /* DEBUG */
 	}
 
 	uint8_t pos = u8p->cache[0] + 1U - len;
 	u8p->cache[pos] = byte;
-
-#ifdef DEBUG
-	for (;k < pos; ++k) {
-		pr_(" [%02" PRIx8 "]", u8p->cache[k]);
-	}
-	pr_(" [\033[1;3%" PRIu8 "m%02" PRIx8 "\033[m]", pos, u8p->cache[k]);
-	for (; ++k < sizeof u8p->cache;) {
-		pr_(" [%02" PRIx8 "]", u8p->cache[k]);
-	}
-#endif /* DEBUG */
 }
 
-#undef UTF8_PARSER_DESCRIPTOR
-
 /**
  * @brief Update the UTF-8 parser state and cache based on an input byte.
  *
@@ -293,9 +249,9 @@ utf8_push_to_cache (struct utf8 *const u8p,
  */
 __attribute__((nonnull(1,2)))
 utf8_force_inline bool
-utf8_set_state (struct utf8 *const   u8p,
-                enum utf8_st8 *const st8,
-                uint8_t              byte)
+utf8_update_state (struct utf8 *const   u8p,
+                   enum utf8_st8 *const st8,
+                   uint8_t              byte)
 {
 	uint16_t next_bit = utf8_lut[byte] &
 	                    utf8_get_allowed_next_states(*st8);
@@ -311,13 +267,35 @@ utf8_set_state (struct utf8 *const   u8p,
 	u8p->state = next_bit;
 	utf8_push_to_cache(u8p, (enum utf8_st8)e, byte);
 
-	pr_("  %6s -> %-6s", utf8_st8_name(*st8),
-	                     utf8_st8_name((enum utf8_st8)e));
-
 	*st8 = (enum utf8_st8)e;
 	return true;
 }
 
+/**
+ * @brief Update the UTF-8 parser state and cache based on an input byte,
+ *        and count the transition in profiling builds.
+ *
+ * Same as @ref utf8_update_state() otherwise.
+ */
+__attribute__((nonnull(1,2)))
+utf8_force_inline bool
+utf8_set_state (struct utf8 *const   u8p,
+                enum utf8_st8 *const st8,
+                uint8_t              byte)
+{
+#ifdef UTF8_PROFILE
+	enum utf8_st8 from = *st8;
+	if (!utf8_update_state(u8p, st8, byte)) {
+		utf8_prof_error(from);
+		return false;
+	}
+	utf8_prof_step(from, *st8, utf8_done(u8p) ? u8p->cache[0] : 0U);
+	return true;
+#else /* UTF8_PROFILE */
+	return utf8_update_state(u8p, st8, byte);
+#endif /* UTF8_PROFILE */
+}
+
 utf8_nonnull_in utf8_nonnull_out
 uint8_t const *
 utf8_parse_next_code_point (struct utf8 *const  u8p,
@@ -338,4 +316,663 @@ utf8_parse_next_code_point (struct utf8 *const  u8p,
 	return ptr;
 }
 
+utf8_nonnull_in
+struct utf8_span
+utf8_parse_span (struct utf8 *const  u8p,
+                 uint8_t const      *ptr,
+                 uint8_t const      *end)
+{
+	enum utf8_st8 st8 = utf8_ini;
+	size_t count = 0;
+
+	if (utf8_get_state(u8p, &st8)) {
+		u8p->error = 0;
+		while (ptr < end) {
+			// Skip ASCII runs without a state update per byte
+			if (*ptr < 0x80U && utf8_expects_leading_byte(u8p)) {
+				size_t n = utf8_ascii_run(ptr, end);
+				utf8_prof_run(st8, n);
+				ptr += n;
+				count += n;
+				st8 = utf8_asc;
+				u8p->state = utf8_bit(asc);
+				utf8_push_to_cache(u8p, utf8_asc, ptr[-1]);
+				continue;
+			}
+
+			if (!utf8_set_state(u8p, &st8, *ptr))
+				break;
+			++ptr;
+			count += utf8_done(u8p);
+		}
+	}
+
+	return (struct utf8_span) {
+		.ptr   = ptr,
+		.count = count,
+	};
+}
+
+/**
+ * @brief Shift DFA transition table.
+ *
+ * One row per byte value, each row holding the next state for all 16
+ * parser states as 4-bit fields, so that a state transition is a load
+ * and a shift: `next = utf8_dfa[byte] >> (state << 2) & 15`.
+ *
+ * The initial state @ref utf8_ini has the same transitions as
+ * @ref utf8_asc and the DFA never returns to it, so its field is
+ * reused as the error state.
+ *
+ * Filled in once from @ref utf8_lut and @ref utf8_dst on first use.
+ */
+static uint64_t utf8_dfa[256];
+
+/**
+ * @brief Byte equivalence classes of the shift DFA.
+ *
+ * Bytes with the same @ref utf8_lut entry have the same transitions
+ * in every state. There are 12 such classes; the byte pair table has
+ * room for 16.
+ */
+static uint8_t utf8_dfa2_cls[256];
+
+/**
+ * @brief Two-byte stride DFA transition table.
+ *
+ * Indexed by `c0 << 8 | c1 << 4 | state`, where `c0` and `c1` are the
+ * classes of two consecutive bytes. Bits 0-3 of an entry are the state
+ * after both bytes, @ref utf8_ini if either of them is invalid, and
+ * bits 4-5 the number of code points the two bytes complete.
+ *
+ * The classes are looked up independently of the state, which leaves
+ * one table load per two bytes on the dependency chain. The full
+ * `[state][uint16_t]` table would be 1 MiB of bytes, this one is 4 KiB.
+ */
+static uint8_t utf8_dfa2[4096];
+
+/**
+ * @brief Reverse state transition table.
+ *
+ * The set of states which may precede each state, as state flags
+ * indexed by state enumeration; the transpose of @ref utf8_dst. The
+ * initial state @ref utf8_ini is left out, as it never follows a byte.
+ *
+ * Filled in once from @ref utf8_dst on first use.
+ */
+static uint16_t utf8_src[16];
+
+static once_flag utf8_dfa_once = ONCE_FLAG_INIT;
+
+/**
+ * @brief Take a shift DFA transition.
+ *
+ * @param st8  The current state, not @ref utf8_ini.
+ * @param byte The next input byte.
+ * @return The next state, or @ref utf8_ini if `byte` is invalid.
+ */
+utf8_force_inline unsigned
+utf8_dfa_step (unsigned st8,
+               uint8_t  byte)
+{
+	return (unsigned)(utf8_dfa[byte] >> (st8 << 2U)) & 0xfU;
+}
+
+/**
+ * @brief Build @ref utf8_dfa, @ref utf8_dfa2_cls, @ref utf8_dfa2 and
+ *        @ref utf8_src from the state transition tables.
+ */
+static void
+utf8_dfa_init (void)
+{
+	assert(utf8_dst[utf8_ini] == utf8_dst[utf8_asc]);
+
+	for (unsigned st8 = 0; st8 < utf8_ini; ++st8) {
+		for (unsigned prev = 0; prev < utf8_ini; ++prev)
+			utf8_src[st8] |= (uint16_t)((utf8_dst[prev] >> st8 & 1U)
+			                            << prev);
+	}
+
+	for (size_t b = 0; b < array_size(utf8_dfa); ++b) {
+		uint64_t row = 0;
+		for (unsigned st8 = 0; st8 < 16U; ++st8) {
+			uint64_t next = utf8_ini;
+			if (st8 != utf8_ini) {
+				int e = utf8_state_from_bit(utf8_lut[b] &
+				                            utf8_dst[st8]);
+				if (e >= 0)
+					next = (uint64_t)e;
+			}
+			row |= next << (st8 << 2U);
+		}
+		utf8_dfa[b] = row;
+	}
+
+	constexpr const uint16_t fin = utf8_bit(asc) | utf8_bit(cb1);
+	uint8_t rep[16] = {0};
+	unsigned n_cls = 0;
+
+	for (unsigned b = 0; b < array_size(utf8_dfa2_cls); ++b) {
+		unsigned c = 0;
+		while (c < n_cls && utf8_lut[rep[c]] != utf8_lut[b])
+			++c;
+		if (c == n_cls) {
+			assert(n_cls < array_size(rep));
+			rep[n_cls++] = (uint8_t)b;
+		}
+		utf8_dfa2_cls[b] = (uint8_t)c;
+	}
+
+	for (unsigned c0 = 0; c0 < n_cls; ++c0) {
+		for (unsigned c1 = 0; c1 < n_cls; ++c1) {
+			for (unsigned st8 = 0; st8 < 16U; ++st8) {
+				unsigned mid = utf8_dfa_step(st8, rep[c0]);
+				unsigned next = mid == utf8_ini ? utf8_ini
+				              : utf8_dfa_step(mid, rep[c1]);
+				unsigned done = next == utf8_ini ? 0U
+				              : (fin >> mid & 1U) + (fin >> next & 1U);
+				utf8_dfa2[c0 << 8U | c1 << 4U | st8] =
+					(uint8_t)(done << 4U | next);
+			}
+		}
+	}
+}
+
+#ifdef UTF8_PROFILE
+/**
+ * @brief Count a shift DFA transition.
+ *
+ * @param from The state before the byte.
+ * @param to   The state after the byte.
+ * @param seq  The length of the current sequence, updated if `to` is
+ *             a leading byte state.
+ */
+utf8_force_inline void
+utf8_prof_dfa (unsigned        from,
+               unsigned        to,
+               unsigned *const seq)
+{
+	if (utf8_st8_is_leading_byte((enum utf8_st8)to))
+		*seq = utf8_len[to];
+	utf8_prof_step(from, to,
+	               (utf8_bit(asc) | utf8_bit(cb1)) >> to & 1U ? *seq : 0U);
+}
+#endif /* UTF8_PROFILE */
+
+/**
+ * @brief Finish a span parsed without updating the parser object.
+ *
+ * Replays the last code point, complete or not, through the state
+ * machine to leave the parser state and cache as utf8_parse_span()
+ * would. The bytes have been counted already, so the replay uses the
+ * non-profiling update.
+ *
+ * @param u8p   The parser, still in the state it was in at `beg`.
+ * @param st8   The state enumeration of `u8p->state`.
+ * @param beg   Start of the span.
+ * @param ptr   Where parsing stopped; before `end` only on error.
+ * @param end   End of the span.
+ * @param count The number of complete code points consumed.
+ * @return The span result.
+ */
+__attribute__((nonnull(1,3,4,5)))
+utf8_force_inline struct utf8_span
+utf8_span_end (struct utf8 *const  u8p,
+               enum utf8_st8       st8,
+               uint8_t const      *beg,
+               uint8_t const      *ptr,
+               uint8_t const      *end,
+               size_t              count)
+{
+	if (ptr != beg) {
+		uint8_t const *q = ptr - 1;
+		while (q > beg && !(utf8_lut[*q] & utf8_dst[utf8_ini]))
+			--q;
+
+		if (utf8_lut[*q] & utf8_dst[utf8_ini]) {
+			u8p->state = utf8_bit(asc);
+			st8 = utf8_asc;
+		}
+
+		for (; q < ptr; ++q)
+			(void)utf8_update_state(u8p, &st8, *q);
+	}
+
+	u8p->error = ptr < end ? EILSEQ : 0;
+
+	return (struct utf8_span) {
+		.ptr   = ptr,
+		.count = count,
+	};
+}
+
+utf8_nonnull_in
+struct utf8_span
+utf8_parse_span_dfa (struct utf8 *const  u8p,
+                     uint8_t const      *ptr,
+                     uint8_t const      *end)
+{
+	enum utf8_st8 st8 = utf8_ini;
+	size_t count = 0;
+
+	if (!utf8_get_state(u8p, &st8))
+		return (struct utf8_span) {
+			.ptr   = ptr,
+			.count = 0,
+		};
+
+	call_once(&utf8_dfa_once, utf8_dfa_init);
+
+	uint8_t const *const beg = ptr;
+	unsigned s = st8 == utf8_ini ? utf8_asc : st8;
+#ifdef UTF8_PROFILE
+	unsigned seq = u8p->cache[0];
+#endif /* UTF8_PROFILE */
+
+	while (ptr < end) {
+		if (*ptr < 0x80U && (s == utf8_asc || s == utf8_cb1)) {
+			size_t n = utf8_ascii_run(ptr, end);
+			utf8_prof_run(s, n);
+			ptr += n;
+			count += n;
+			s = utf8_asc;
+			continue;
+		}
+
+		unsigned next = utf8_dfa_step(s, *ptr);
+		if (next == utf8_ini) {
+			utf8_prof_error(s);
+			break;
+		}
+
+#ifdef UTF8_PROFILE
+		utf8_prof_dfa(s, next, &seq);
+#endif /* UTF8_PROFILE */
+
+		++ptr;
+		count += (utf8_bit(asc) | utf8_bit(cb1)) >> next & 1U;
+		s = next;
+	}
+
+	return utf8_span_end(u8p, st8, beg, ptr, end, count);
+}
+
+utf8_nonnull_in
+struct utf8_span
+utf8_parse_span_dfa2 (struct utf8 *const  u8p,
+                      uint8_t const      *ptr,
+                      uint8_t const      *end)
+{
+	enum utf8_st8 st8 = utf8_ini;
+	size_t count = 0;
+
+	if (!utf8_get_state(u8p, &st8))
+		return (struct utf8_span) {
+			.ptr   = ptr,
+			.count = 0,
+		};
+
+	call_once(&utf8_dfa_once, utf8_dfa_init);
+
+	uint8_t const *const beg = ptr;
+	unsigned s = st8 == utf8_ini ? utf8_asc : st8;
+#ifdef UTF8_PROFILE
+	unsigned seq = u8p->cache[0];
+#endif /* UTF8_PROFILE */
+
+	while (ptr < end) {
+		if (*ptr < 0x80U && (s == utf8_asc || s == utf8_cb1)) {
+			size_t n = utf8_ascii_run(ptr, end);
+			utf8_prof_run(s, n);
+			ptr += n;
+			count += n;
+			s = utf8_asc;
+			continue;
+		}
+
+		if (end - ptr >= 2) {
+			unsigned e = utf8_dfa2[utf8_dfa2_cls[ptr[0]] << 8U |
+			                       utf8_dfa2_cls[ptr[1]] << 4U | s];
+			unsigned next = e & 0xfU;
+			if (next != utf8_ini) {
+#ifdef UTF8_PROFILE
+				unsigned mid = utf8_dfa_step(s, ptr[0]);
+				utf8_prof_dfa(s, mid, &seq);
+				utf8_prof_dfa(mid, next, &seq);
+#endif /* UTF8_PROFILE */
+				ptr += 2;
+				count += e >> 4U;
+				s = next;
+				continue;
+			}
+		}
+
+		// A single byte at the end, or one of a pair with an error
+		unsigned next = utf8_dfa_step(s, *ptr);
+		if (next == utf8_ini) {
+			utf8_prof_error(s);
+			break;
+		}
+
+#ifdef UTF8_PROFILE
+		utf8_prof_dfa(s, next, &seq);
+#endif /* UTF8_PROFILE */
+
+		++ptr;
+		count += (utf8_bit(asc) | utf8_bit(cb1)) >> next & 1U;
+		s = next;
+	}
+
+	return utf8_span_end(u8p, st8, beg, ptr, end, count);
+}
+
+/* The direct-threaded engine is generated from the parser descriptor.
+ * Each state's successor check needs its own pass over the descriptor,
+ * which can't be expanded while the outer pass is; deferring the inner
+ * pass's macro name until an extra rescan gets around that.
+ */
+//! @cond
+#define UTF8_EMPTY_()
+#define UTF8_DEFER_(m) m UTF8_EMPTY_()
+#define UTF8_EXPAND_(...) __VA_ARGS__
+#define UTF8_DESCRIPTOR_() UTF8_PARSER_DESCRIPTOR
+//! @endcond
+
+/* Computed goto is a GNU extension. Without it a leading or ASCII
+ * byte is dispatched with the same chain of range checks that the
+ * continuation states use.
+ */
+#ifdef __GNUC__
+# define UTF8_COMPUTED_GOTO
+#endif /* __GNUC__ */
+
+#ifdef UTF8_COMPUTED_GOTO
+utf8_diag(push)
+utf8_diag(ignored "-Wpedantic")
+#endif /* UTF8_COMPUTED_GOTO */
+
+/**
+ * @brief Check if a byte is in the byte ranges of a state, as given
+ *        by the start, run, skip and run columns of the descriptor.
+ */
+utf8_const_inline bool
+utf8_byte_in_ranges (uint8_t  byte,
+                     unsigned start,
+                     unsigned run,
+                     unsigned skip,
+                     unsigned run2)
+{
+	return (unsigned)(byte - start) < run
+	    || (unsigned)(byte - start - run - skip) < run2;
+}
+
+utf8_nonnull_in
+struct utf8_span
+utf8_parse_span_goto (struct utf8 *const  u8p,
+                      uint8_t const      *ptr,
+                      uint8_t const      *end)
+{
+	enum utf8_st8 st8 = utf8_ini;
+	size_t count = 0;
+
+	if (!utf8_get_state(u8p, &st8))
+		return (struct utf8_span) {
+			.ptr   = ptr,
+			.count = 0,
+		};
+
+	uint8_t const *const beg = ptr;
+	uint8_t byte;
+
+#ifdef UTF8_PROFILE
+	unsigned prev = st8, seq = u8p->cache[0];
+	//! @cond
+	#define utf8_prof_enter_(n, len) do {                          \
+		if (utf8_st8_is_leading_byte(n))                       \
+			seq = (len);                                   \
+		utf8_prof_step(prev, (n), (utf8_bit(asc) |             \
+		               utf8_bit(cb1)) >> (n) & 1U ? seq : 0U); \
+		prev = (n);                                            \
+	} while (0)
+	#define utf8_prof_run_(n) do {                                 \
+		utf8_prof_run(prev, (n));                              \
+		prev = utf8_asc;                                       \
+	} while (0)
+	#define utf8_prof_error_() utf8_prof_error(prev)
+	//! @endcond
+#else /* UTF8_PROFILE */
+	//! @cond
+	#define utf8_prof_enter_(...)
+	#define utf8_prof_run_(...)
+	#define utf8_prof_error_()
+	//! @endcond
+#endif /* UTF8_PROFILE */
+
+#ifdef UTF8_COMPUTED_GOTO
+	// Leading bytes are dispatched by the utf8_asc field of their
+	// DFA row, which holds the utf8_ini error state if the byte is
+	// not a valid leading byte.
+	static void *const lead[16] = {
+		//! @cond
+		#define F(n,m,...) [n] = n == utf8_ini ? &&bad : &&enter_##m,
+		//! @endcond
+		UTF8_PARSER_DESCRIPTOR(F)
+		//! @cond
+		#undef F
+		//! @endcond
+	};
+
+	call_once(&utf8_dfa_once, utf8_dfa_init);
+
+	//! @cond
+	#define UTF8_LEAD_DISPATCH_() do {                             \
+		++ptr;                                                 \
+		goto *lead[utf8_dfa[byte] & 0xfU];                     \
+	} while (0)
+	//! @endcond
+#else /* UTF8_COMPUTED_GOTO */
+	//! @cond
+	#define UTF8_LEAD_DISPATCH_()
+	//! @endcond
+#endif /* UTF8_COMPUTED_GOTO */
+
+	switch (st8) {
+	//! @cond
+	#define F(n,m,...) case utf8_##m: goto resume_##m;
+	//! @endcond
+	UTF8_PARSER_DESCRIPTOR(F)
+	//! @cond
+	#undef F
+	//! @endcond
+	}
+
+	// One block per state, entered when a byte leading to the state
+	// has been consumed. States that accept leading bytes skip ASCII
+	// runs and dispatch on the leading byte; the rest check the next
+	// byte against the range of their one successor. The successor
+	// checks are a chain over all states, but the state map is known
+	// at compile time and all but the applicable checks fold away.
+	//! @cond
+	#define G(k,m,l,...)                                           \
+		if ((utf8_dst[cur] >> k & 1U) &&                       \
+		    utf8_byte_in_ranges(byte, __VA_ARGS__)) {          \
+			++ptr;                                         \
+			goto enter_##m;                                \
+		}
+	#define F(n,m,l,...)                                           \
+	enter_##m:                                                     \
+		utf8_prof_enter_(n, l);                                \
+		count += (utf8_bit(asc) | utf8_bit(cb1)) >> n & 1U;    \
+	resume_##m: {                                                  \
+		enum { cur = n };                                      \
+		if (ptr == end)                                        \
+			goto stop;                                     \
+		byte = *ptr;                                           \
+		if (utf8_dst[cur] & utf8_bit(asc)) {                   \
+			if (byte < 0x80U) {                            \
+				size_t k = utf8_ascii_run(ptr, end);   \
+				utf8_prof_run_(k);                     \
+				ptr += k;                              \
+				count += k;                            \
+				goto resume_asc;                       \
+			}                                              \
+			UTF8_LEAD_DISPATCH_();                         \
+		}                                                      \
+		UTF8_DEFER_(UTF8_DESCRIPTOR_)()(G)                     \
+		goto fail;                                             \
+	}
+	//! @endcond
+
+	UTF8_EXPAND_(UTF8_PARSER_DESCRIPTOR(F))
+
+	//! @cond
+	#undef F
+	#undef G
+	//! @endcond
+
+#ifdef UTF8_COMPUTED_GOTO
+bad:
+	--ptr;
+#endif /* UTF8_COMPUTED_GOTO */
+fail:
+	utf8_prof_error_();
+stop:
+	return utf8_span_end(u8p, st8, beg, ptr, end, count);
+
+	//! @cond
+	#undef UTF8_LEAD_DISPATCH_
+	#undef utf8_prof_error_
+	#undef utf8_prof_run_
+	#undef utf8_prof_enter_
+	//! @endcond
+}
+
+#ifdef UTF8_COMPUTED_GOTO
+utf8_diag(pop)
+#endif /* UTF8_COMPUTED_GOTO */
+
+//! @cond
+#undef UTF8_COMPUTED_GOTO
+#undef UTF8_DESCRIPTOR_
+#undef UTF8_EXPAND_
+#undef UTF8_DEFER_
+#undef UTF8_EMPTY_
+//! @endcond
+
+/**
+ * @brief Find the start of the code point which ends right before
+ *        `ptr`, without reading before `begin`.
+ *
+ * Runs the state machine backwards with @ref utf8_src. Several states
+ * can precede a state, so the walk tracks the set of states each byte
+ * may be in, from the last byte, which must be in a state that can be
+ * followed by a leading byte, back to the first leading byte. The
+ * bytes are then accepted exactly when the forward parser would accept
+ * them. @ref utf8_src must have been filled in.
+ *
+ * @param begin Start of the buffer.
+ * @param ptr   End of the code point.
+ * @return The first byte of the code point, or `nullptr` if the bytes
+ *         before `ptr` don't end in a valid code point.
+ */
+utf8_nonnull_in
+utf8_force_inline uint8_t const *
+utf8_prev_start (uint8_t const *const begin,
+                 uint8_t const       *ptr)
+{
+	uint16_t allowed = utf8_src[utf8_asc];
+	uint16_t cur;
+
+	do {
+		if (ptr <= begin)
+			return nullptr;
+		cur = utf8_lut[*--ptr] & allowed;
+		allowed = 0;
+		for (unsigned m = cur; m; m &= m - 1U)
+			allowed |= utf8_src[__builtin_ctz(m)];
+	} while (cur & ~utf8_dst[utf8_ini]);
+
+	return cur ? ptr : nullptr;
+}
+
+utf8_nonnull_in utf8_nonnull_out
+uint8_t const *
+utf8_parse_prev_code_point (struct utf8 *const   u8p,
+                            uint8_t const *const begin,
+                            uint8_t const *const ptr)
+{
+	call_once(&utf8_dfa_once, utf8_dfa_init);
+
+	if (ptr <= begin) {
+		utf8_reset(u8p);
+		return ptr;
+	}
+
+	uint8_t const *const p = utf8_prev_start(begin, ptr);
+	if (!p) {
+		u8p->error = EILSEQ;
+		return ptr;
+	}
+
+	// Replay the code point forwards to leave the state and cache as
+	// utf8_parse_next_code_point() would. It is known to be valid.
+	enum utf8_st8 st8 = utf8_ini;
+	u8p->state = utf8_bit(ini);
+	for (uint8_t const *q = p; q < ptr; ++q)
+		(void)utf8_update_state(u8p, &st8, *q);
+	u8p->error = 0;
+
+	return p;
+}
+
+utf8_nonnull_in utf8_nonnull_out
+uint8_t const *
+utf8_prev_boundary (uint8_t const *const begin,
+                    uint8_t const       *ptr)
+{
+	call_once(&utf8_dfa_once, utf8_dfa_init);
+
+#if defined __SSE2__ && !defined UTF8_NO_SIMD
+	// A code point can only end in an ASCII byte or in a continuation
+	// byte with a leading byte 0xc2-0xff at most three bytes before
+	// it. Only the positions after such bytes are checked, from the
+	// last one down, 16 bytes at a time.
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const lb = _mm_set1_epi8((char)0xc1);
+	__m128i const cb = _mm_set1_epi8((char)0xc0);
+
+	for (; ptr - begin >= 19; ptr -= 16) {
+		__m128i v = _mm_loadu_si128((__m128i const *)(ptr - 16));
+		__m128i lead = zero;
+		for (unsigned i = 1U; i <= 3U; ++i) {
+			__m128i w = _mm_loadu_si128((__m128i const *)
+			                            (ptr - 16 - i));
+			lead = _mm_or_si128(lead, _mm_and_si128(
+				_mm_cmpgt_epi8(w, lb), _mm_cmpgt_epi8(zero, w)));
+		}
+
+		unsigned m = (unsigned)_mm_movemask_epi8(_mm_or_si128(
+			_mm_cmpgt_epi8(v, _mm_set1_epi8(-1)),
+			_mm_and_si128(_mm_cmpgt_epi8(cb, v), lead)));
+
+		while (m) {
+			unsigned i = 31U - (unsigned)__builtin_clz(m);
+			uint8_t const *q = ptr - 15 + i;
+			if (utf8_prev_start(begin, q))
+				return q;
+			m ^= 1U << i;
+		}
+	}
+#endif /* __SSE2__ && !UTF8_NO_SIMD */
+
+	for (; ptr > begin; --ptr) {
+		if (utf8_prev_start(begin, ptr))
+			break;
+	}
+
+	return ptr;
+}
+
+#undef UTF8_PARSER_DESCRIPTOR
+
 #endif /* !__cplusplus */
@@ -240,6 +240,307 @@ extern uint8_t const *
 utf8_parse_next_code_point (struct utf8   *u8p,
                             uint8_t const *ptr) utf8_nonnull_in;
 
+/**
+ * @brief Parse the previous UTF-8 code point from a byte buffer.
+ *
+ * The reverse of @ref utf8_parse_next_code_point(): parses the code
+ * point which ends right before `ptr`, reading up to 4 bytes backwards
+ * but nothing before `begin`. The state machine is run backwards with
+ * the transpose of its state transition table, so exactly the same
+ * sequences are accepted as in forward parsing. The current state of
+ * the parser is not used.
+ *
+ * On valid input `u8p->error` is assigned 0, the parser state and
+ * cache are left as @ref utf8_parse_next_code_point() would leave
+ * them after the same code point, and the address of its first byte
+ * is returned. @ref utf8_result() and @ref utf8_size() work as usual.
+ *
+ * On invalid input, including a sequence cut short by `begin`,
+ * `u8p->error` is assigned `EILSEQ` and `ptr` is returned, i.e.
+ * invalid input is never consumed. Use @ref utf8_prev_boundary() to
+ * skip it.
+ *
+ * If `ptr` is `begin` there is nothing to parse; the parser is reset
+ * and `ptr` is returned.
+ *
+ * @param u8p   A pointer to the UTF-8 parser object. Must not be null.
+ * @param begin A pointer to the start of the input buffer. Must not be
+ *              null.
+ * @param ptr   A pointer to the end of the code point. Must not be null
+ *              or less than `begin`.
+ * @return A pointer to the first byte of the parsed code point, or
+ *         `ptr` if nothing was parsed.
+ *
+ * @public @memberof utf8
+ */
+utf8_nonnull_out
+extern uint8_t const *
+utf8_parse_prev_code_point (struct utf8   *u8p,
+                            uint8_t const *begin,
+                            uint8_t const *ptr) utf8_nonnull_in;
+
+/**
+ * @brief Find the last code point boundary at or before a position.
+ *
+ * Returns the last position `q` in `[begin, ptr]` which is either
+ * `begin` or the end of a valid code point, so that
+ * @ref utf8_parse_prev_code_point() succeeds at `q`. On valid input
+ * that is `ptr` moved back to the start of the sequence it falls
+ * into, e.g. to truncate text to at most `ptr - begin` bytes; invalid
+ * bytes are skipped over. Positions which can't end a code point are
+ * ruled out 16 bytes at a time with vector instructions where
+ * available.
+ *
+ * @param begin A pointer to the start of the input buffer. Must not be
+ *              null.
+ * @param ptr   A pointer to the position to start from. Must not be
+ *              null or less than `begin`.
+ * @return The boundary.
+ */
+utf8_nonnull_out
+extern uint8_t const *
+utf8_prev_boundary (uint8_t const *begin,
+                    uint8_t const *ptr) utf8_nonnull_in;
+
+/**
+ * @brief Result of parsing a span of UTF-8 input.
+ */
+struct utf8_span {
+	/** @brief Address of the first byte not consumed. */
+	uint8_t const *ptr;
+	/** @brief Number of complete code points consumed. */
+	size_t         count;
+};
+
+/**
+ * @brief Parse UTF-8 code points from a length-delimited byte buffer.
+ *
+ * Consumes input from `ptr` up to but not including `end`, as if by
+ * calling @ref utf8_parse_next_code_point() repeatedly, but without
+ * reading past `end` and without treating a null byte as anything
+ * other than ASCII. Parsing continues from the current parser state,
+ * so input may be fed in consecutive spans.
+ *
+ * On valid input `u8p->error` is assigned 0 and the returned span's
+ * `ptr` equals `end`. If `end` falls inside a multi-byte sequence,
+ * the bytes of the incomplete sequence are consumed into the parser
+ * state and are not counted; the next call picks up where this one
+ * left off. @ref utf8_expects_leading_byte() tells whether the span
+ * ended on a code point boundary.
+ *
+ * On invalid input `u8p->error` is assigned `EILSEQ` and the span's
+ * `ptr` is the address of the first invalid byte, like it is with
+ * @ref utf8_parse_next_code_point().
+ *
+ * If the content of `u8p->state` is corrupt, `u8p->error` is assigned
+ * `ENOTRECOVERABLE` and nothing is consumed.
+ *
+ * @param u8p A pointer to the UTF-8 parser object. Must not be null.
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param end A pointer to the end of the input buffer. Must not be
+ *            null or less than `ptr`.
+ * @return The stop position and the number of complete code points
+ *         consumed.
+ *
+ * @public @memberof utf8
+ */
+extern struct utf8_span
+utf8_parse_span (struct utf8   *u8p,
+                 uint8_t const *ptr,
+                 uint8_t const *end) utf8_nonnull_in;
+
+/**
+ * @brief Parse UTF-8 code points from a length-delimited byte buffer
+ *        using the shift DFA engine.
+ *
+ * Behaves exactly like @ref utf8_parse_span(), but drives the state
+ * machine with a transition table holding the next state for all 16
+ * parser states in one 64-bit row per byte value. A transition is a
+ * single table load and shift instead of the bitmask intersection,
+ * power-of-two check and bit scan of the default engine. The parser
+ * object is only written once, when the span has been consumed.
+ *
+ * @param u8p A pointer to the UTF-8 parser object. Must not be null.
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param end A pointer to the end of the input buffer. Must not be
+ *            null or less than `ptr`.
+ * @return The stop position and the number of complete code points
+ *         consumed.
+ *
+ * @public @memberof utf8
+ */
+extern struct utf8_span
+utf8_parse_span_dfa (struct utf8   *u8p,
+                     uint8_t const *ptr,
+                     uint8_t const *end) utf8_nonnull_in;
+
+/**
+ * @brief Parse UTF-8 code points from a length-delimited byte buffer
+ *        using the two-byte stride DFA engine.
+ *
+ * Behaves exactly like @ref utf8_parse_span_dfa(), but takes two bytes
+ * per transition, which halves the length of the chain of dependent
+ * table loads. The transition table is indexed by the equivalence
+ * classes of the two bytes rather than their values, which keeps it
+ * at 4 KiB. Errors and a byte left over at the end are handled one
+ * byte at a time.
+ *
+ * @param u8p A pointer to the UTF-8 parser object. Must not be null.
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param end A pointer to the end of the input buffer. Must not be
+ *            null or less than `ptr`.
+ * @return The stop position and the number of complete code points
+ *         consumed.
+ *
+ * @public @memberof utf8
+ */
+extern struct utf8_span
+utf8_parse_span_dfa2 (struct utf8   *u8p,
+                      uint8_t const *ptr,
+                      uint8_t const *end) utf8_nonnull_in;
+
+/**
+ * @brief Parse UTF-8 code points from a length-delimited byte buffer
+ *        using the direct-threaded engine.
+ *
+ * Behaves exactly like @ref utf8_parse_span(), but runs a parser
+ * generated from @ref UTF8_PARSER_DESCRIPTOR at compile time instead
+ * of interpreting the state transition tables. Every state is a block
+ * of code of its own, with the byte range checks of its successors
+ * inlined as constants. Leading bytes are dispatched with a computed
+ * goto where the compiler supports it, and with a chain of range
+ * checks otherwise. As with @ref utf8_parse_span_dfa(), the parser
+ * object is only written once, when the span has been consumed.
+ *
+ * @param u8p A pointer to the UTF-8 parser object. Must not be null.
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param end A pointer to the end of the input buffer. Must not be
+ *            null or less than `ptr`.
+ * @return The stop position and the number of complete code points
+ *         consumed.
+ *
+ * @public @memberof utf8
+ */
+extern struct utf8_span
+utf8_parse_span_goto (struct utf8   *u8p,
+                      uint8_t const *ptr,
+                      uint8_t const *end) utf8_nonnull_in;
+
+/**
+ * @brief Status of a code point decoded by @ref utf8_decode_next().
+ */
+utf8_fixed_enum(utf8_decode_status, uint8_t) {
+	/** A complete, valid sequence. */
+	utf8_decode_ok,
+	/** An invalid sequence. */
+	utf8_decode_invalid,
+	/** A valid but incomplete sequence cut short by the end of
+	 *  the input, or no input at all. */
+	utf8_decode_truncated,
+};
+
+/**
+ * @brief A code point decoded by @ref utf8_decode_next().
+ *
+ * Fits in a 64-bit register, and is returned in one by value on the
+ * common calling conventions.
+ */
+struct utf8_decoded {
+	/** @brief The code point, or U+FFFD if not @ref utf8_decode_ok. */
+	uint32_t                code_point;
+	/** @brief Number of input bytes the result stands for. */
+	uint8_t                 len;
+	/** @brief Whether the sequence was complete and valid. */
+	enum utf8_decode_status status;
+};
+
+/**
+ * @brief Decode the UTF-8 code point at the start of a buffer.
+ *
+ * A stateless alternative to @ref utf8_parse_next_code_point() for
+ * loops over a buffer. The byte ranges of the state machine are
+ * checked inline and nothing but the input is read from or written
+ * to memory, so the decoding state of a loop stays in registers
+ * instead of going through the parser object and its cache:
+ *
+ * @code{.c}
+ * while (ptr < end) {
+ *         struct utf8_decoded d = utf8_decode_next(ptr, end);
+ *         if (d.status == utf8_decode_truncated)
+ *                 break;
+ *         use(d.code_point);
+ *         ptr += d.len;
+ * }
+ * @endcode
+ *
+ * An invalid sequence decodes to U+FFFD with `len` the length of its
+ * maximal subpart, as recommended by Unicode; `len` is never 0 unless
+ * `ptr` equals `end`. The validity rules are those of the parser. To
+ * resume decoding a truncated sequence when more input arrives, feed
+ * its bytes to @ref utf8_parse_span() or keep them for the next call.
+ *
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param end A pointer to the end of the input buffer. Must not be
+ *            null or less than `ptr`.
+ * @return The code point, its length and status.
+ */
+utf8_nonnull_in
+utf8_force_inline struct utf8_decoded
+utf8_decode_next (uint8_t const *const ptr,
+                  uint8_t const *const end)
+{
+	struct utf8_decoded d = {0xfffdU, 0, utf8_decode_truncated};
+	if (ptr == end)
+		return d;
+
+	uint32_t c = *ptr;
+	d.len = 1;
+	if (c < 0x80U) {
+		d.code_point = c;
+		d.status = utf8_decode_ok;
+		return d;
+	}
+
+	// The sequence length, and the range of the second byte that
+	// excludes overlongs, surrogates and values above U+10FFFF
+	uint8_t n, lo = 0x80U, hi = 0xbfU;
+	if (c - 0xc2U < 0x1eU) {
+		n = 2;
+	} else if (c - 0xe0U < 0x10U) {
+		n = 3;
+		if (c == 0xe0U)
+			lo = 0xa0U;
+		else if (c == 0xedU)
+			hi = 0x9fU;
+	} else if (c - 0xf0U < 0x05U) {
+		n = 4;
+		if (c == 0xf0U)
+			lo = 0x90U;
+		else if (c == 0xf4U)
+			hi = 0x8fU;
+	} else {
+		d.status = utf8_decode_invalid;
+		return d;
+	}
+
+	c &= 0x7fU >> n;
+	for (uint8_t i = 1; i < n; ++i, lo = 0x80U, hi = 0xbfU) {
+		d.len = i;
+		if (&ptr[i] == end)
+			return d;
+		if (ptr[i] < lo || ptr[i] > hi) {
+			d.status = utf8_decode_invalid;
+			return d;
+		}
+		c = c << 6U | (ptr[i] & 0x3fU);
+	}
+
+	d.code_point = c;
+	d.len = n;
+	d.status = utf8_decode_ok;
+	return d;
+}
+
 /**
  * @brief Get the result of the last UTF-8 code point parsing operation.
  *
@@ -303,6 +604,739 @@ utf8_expects_leading_byte (struct utf8 const *const u8p)
 	return u8p->state & (utf8_bit(asc) | utf8_bit(cb1) | utf8_bit(ini));
 }
 
+/**
+ * @brief Check if a buffer contains only valid UTF-8.
+ *
+ * Validates `len` bytes starting at `ptr` in bulk, using vector
+ * instructions where available. The rules applied are exactly
+ * those of @ref utf8_parse_next_code_point(); a null byte is an
+ * ordinary ASCII value and does not terminate the input, and a
+ * multi-byte sequence cut short by the end of the buffer makes
+ * the buffer invalid.
+ *
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param len The size of the input buffer in bytes.
+ * @return `true` if the buffer is valid UTF-8, otherwise `false`.
+ */
+extern bool
+utf8_validate (uint8_t const *ptr,
+               size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Classes of invalid UTF-8, from the restrictions
+ *        documented with @ref UTF8_PARSER_DESCRIPTOR().
+ */
+utf8_fixed_enum(utf8_error_class, uint8_t) {
+	/** No error. */
+	utf8_valid,
+	/** Overlong encoding: leading byte 0xc0 or 0xc1, or 0xe0 or
+	 *  0xf0 followed by a too small continuation byte. */
+	utf8_overlong,
+	/** Surrogate code point: 0xed followed by 0xa0-0xbf. */
+	utf8_surrogate,
+	/** Code point above U+10FFFF: leading byte 0xf5-0xff, or
+	 *  0xf4 followed by 0x90-0xbf. */
+	utf8_too_large,
+	/** Continuation byte where a leading byte was expected. */
+	utf8_stray_continuation,
+	/** Other byte where a continuation byte was expected. */
+	utf8_missing_continuation,
+	/** Multi-byte sequence cut short by the end of the input. */
+	utf8_truncated,
+};
+
+/**
+ * @brief Result of @ref utf8_check().
+ */
+struct utf8_check {
+	/** @brief Offset of the first invalid sequence, or the input
+	 *         length if there is none. */
+	size_t                offset;
+	/** @brief Why the sequence at `offset` is invalid. */
+	enum utf8_error_class error;
+};
+
+/**
+ * @brief Check if a buffer contains only valid UTF-8, and if not,
+ *        find out where and why.
+ *
+ * Validates like @ref utf8_validate(), at the same speed for valid
+ * input. The vector kernels only tell whether a block is valid, so
+ * on failure the offending block is scanned again with the state
+ * machine to find and classify the first invalid sequence.
+ *
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param len The size of the input buffer in bytes.
+ * @return The offset of the first invalid sequence and its error
+ *         class, or `len` and @ref utf8_valid.
+ */
+extern struct utf8_check
+utf8_check (uint8_t const *ptr,
+            size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Check many strings at once with @ref utf8_check().
+ *
+ * Meant for large numbers of short strings, for which the cost of a
+ * call per string would dominate. Strings of up to 256 bytes are
+ * copied together into blocks of a few KiB, which the vector kernels
+ * then validate in one pass each. Only the strings of a block which
+ * turns out to be invalid are checked one by one to locate the errors.
+ * Longer strings, and all strings if the vector kernels aren't used,
+ * go through @ref utf8_check() directly.
+ *
+ * @param ptrs    The strings. Must not be null, nor may any of the
+ *                strings.
+ * @param lens    The sizes of the strings in bytes. Must not be null.
+ * @param n       The number of strings.
+ * @param results Where to store the result of @ref utf8_check() for
+ *                each string. Must not be null.
+ * @return The number of valid strings.
+ */
+extern size_t
+utf8_validate_batch (uint8_t const *const  ptrs[],
+                     size_t const          lens[],
+                     size_t                n,
+                     struct utf8_check     results[]) utf8_nonnull_in;
+
+/**
+ * @brief Count the code points in a buffer of valid UTF-8.
+ *
+ * Counts the bytes which are not continuation bytes, using vector
+ * instructions where available. For valid UTF-8 that is the number
+ * of code points. The input is not validated; use
+ * @ref utf8_validate_count() for input that may be invalid.
+ *
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param len The size of the input buffer in bytes.
+ * @return The number of code points in the buffer.
+ */
+extern size_t
+utf8_count_code_points (uint8_t const *ptr,
+                        size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Validate and count code points in one pass.
+ *
+ * Returns the same span and leaves `u8p` in the same state as
+ * @ref utf8_parse_span() would for `[ptr, ptr + len)`, but validates
+ * and counts in bulk with the kernels of @ref utf8_validate(). A
+ * sequence split off from the previous span is finished first, and
+ * one left incomplete at the end of this span is kept in the parser
+ * state, so input may be fed in consecutive spans.
+ *
+ * @param u8p A pointer to the UTF-8 parser object. Must not be null.
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param len The size of the input buffer in bytes.
+ * @return The stop position and the number of complete code points
+ *         consumed.
+ *
+ * @public @memberof utf8
+ */
+extern struct utf8_span
+utf8_validate_count (struct utf8   *u8p,
+                     uint8_t const *ptr,
+                     size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Validate the next chunk of a stream of UTF-8 encoded text.
+ *
+ * Validates `len` bytes starting at `ptr` as the continuation of the
+ * input seen by previous calls, at the speed of @ref utf8_validate().
+ * A multi-byte sequence split across chunks is carried over in the
+ * parser object: the bytes received so far are kept in its cache, and
+ * the next call finishes the sequence before validating the rest of
+ * its chunk in bulk. Chunks are never copied.
+ *
+ * Unlike with the parsing functions, `u8p->error` is sticky: after
+ * invalid input has been seen, it keeps its value and further calls
+ * return `false` without looking at their input. Call
+ * @ref utf8_reset() to start a new stream.
+ *
+ * @param u8p A pointer to the UTF-8 parser object carrying the stream
+ *            state. Must not be null.
+ * @param ptr A pointer to the chunk. Must not be null.
+ * @param len The size of the chunk in bytes.
+ * @return `true` if the stream is valid so far, otherwise `false`.
+ *
+ * @public @memberof utf8
+ */
+extern bool
+utf8_stream_feed (struct utf8   *u8p,
+                  uint8_t const *ptr,
+                  size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Finish validating a stream of UTF-8 encoded text.
+ *
+ * Checks that the stream fed to @ref utf8_stream_feed() did not end
+ * in the middle of a multi-byte sequence. If it did, `u8p->error` is
+ * assigned `EILSEQ`.
+ *
+ * @param u8p A pointer to the UTF-8 parser object carrying the stream
+ *            state. Must not be null.
+ * @return `true` if the whole stream was valid, otherwise `false`.
+ *
+ * @public @memberof utf8
+ */
+extern bool
+utf8_stream_finish (struct utf8 *u8p) utf8_nonnull_in;
+
+/**
+ * @brief Validate a large buffer on several threads.
+ *
+ * Returns the same span and leaves `u8p` in the same state as
+ * @ref utf8_parse_span() would for `[ptr, ptr + len)`, including
+ * the address of the first invalid byte and the number of complete
+ * code points before it.
+ *
+ * UTF-8 is self-synchronizing: no byte other than a continuation
+ * byte can occur inside a valid multi-byte sequence. The buffer is
+ * split into one segment per thread, each split point moved forward
+ * past any continuation bytes, and the segments are validated
+ * concurrently with the bulk kernels. The seams are checked
+ * afterwards; a sequence that would have run across one is found
+ * there and reported exactly where the serial parser finds it.
+ *
+ * Fewer threads are used if the segments would be smaller than
+ * 1 MiB, and a buffer too small to split is parsed on the calling
+ * thread alone.
+ *
+ * @param u8p      A pointer to the UTF-8 parser object. Must not be
+ *                 null.
+ * @param ptr      A pointer to the input buffer. Must not be null.
+ * @param len      The size of the input buffer in bytes.
+ * @param nthreads The maximum number of threads to use, including the
+ *                 calling thread. 0 means one per online processor.
+ * @return The stop position and the number of complete code points
+ *         consumed.
+ *
+ * @public @memberof utf8
+ */
+extern struct utf8_span
+utf8_validate_mt (struct utf8   *u8p,
+                  uint8_t const *ptr,
+                  size_t         len,
+                  unsigned       nthreads) utf8_nonnull_in;
+
+/**
+ * @brief How the bulk converters handle invalid input.
+ */
+utf8_fixed_enum(utf8_policy, uint8_t) {
+	/** Stop at the first invalid sequence. */
+	utf8_stop,
+	/** Substitute U+FFFD for each maximal subpart of an invalid
+	 *  sequence, as recommended by Unicode and required by the
+	 *  WHATWG Encoding Standard. */
+	utf8_replace,
+};
+
+/**
+ * @brief Result of a bulk conversion.
+ */
+struct utf8_conv {
+	/** @brief Number of input code units converted. */
+	size_t in;
+	/** @brief Number of output code units written. */
+	size_t out;
+	/** @brief 0, or `EILSEQ` if invalid input was found. */
+	int    error;
+};
+
+/**
+ * @brief Decode UTF-8 to UTF-32.
+ *
+ * Validates and decodes `len` bytes starting at `src` in one pass,
+ * writing one `uint32_t` per code point to `dst`. A sequence is valid
+ * exactly when @ref utf8_parse_next_code_point() accepts it, so
+ * overlong encodings, surrogates and values above U+10FFFF are
+ * rejected, as is a sequence cut short by the end of the input.
+ *
+ * The input is checked in blocks with the kernels of
+ * @ref utf8_validate(); valid blocks are decoded without further
+ * checks, with ASCII runs widened in bulk. Only a block with an
+ * error in it is decoded with the state machine.
+ *
+ * With @ref utf8_stop, conversion stops at the first invalid sequence.
+ * The result's `in` is then the offset of that sequence. With
+ * @ref utf8_replace, the whole input is converted.
+ *
+ * @param dst    A pointer to the output buffer, with room for at least
+ *               `len` code points. Must not be null.
+ * @param src    A pointer to the input buffer. Must not be null.
+ * @param len    The size of the input buffer in bytes.
+ * @param policy What to do with invalid input.
+ * @return The number of bytes converted, the number of code points
+ *         written, and `EILSEQ` if invalid input was found.
+ */
+extern struct utf8_conv
+utf8_to_utf32 (uint32_t         *dst,
+               uint8_t const    *src,
+               size_t            len,
+               enum utf8_policy  policy) utf8_nonnull_in;
+
+/**
+ * @brief Transcode UTF-8 to little-endian UTF-16.
+ *
+ * Works like @ref utf8_to_utf32(), but writes UTF-16 code units in
+ * little-endian byte order. Code points above U+FFFF, i.e. those
+ * encoded as four-byte sequences, are written as surrogate pairs.
+ * Since no sequence yields more code units than it has bytes, `len`
+ * code units of output space is always enough.
+ *
+ * @param dst    A pointer to the output buffer, with room for at least
+ *               `len` code units. Must not be null.
+ * @param src    A pointer to the input buffer. Must not be null.
+ * @param len    The size of the input buffer in bytes.
+ * @param policy What to do with invalid input.
+ * @return The number of bytes converted, the number of code units
+ *         written, and `EILSEQ` if invalid input was found. With
+ *         @ref utf8_stop, the number of bytes converted is the offset
+ *         of the first invalid sequence.
+ */
+extern struct utf8_conv
+utf8_to_utf16le (uint16_t         *dst,
+                 uint8_t const    *src,
+                 size_t            len,
+                 enum utf8_policy  policy) utf8_nonnull_in;
+
+/**
+ * @brief Transcode UTF-8 to big-endian UTF-16.
+ *
+ * Same as @ref utf8_to_utf16le(), but the code units are written in
+ * big-endian byte order.
+ *
+ * @param dst    A pointer to the output buffer, with room for at least
+ *               `len` code units. Must not be null.
+ * @param src    A pointer to the input buffer. Must not be null.
+ * @param len    The size of the input buffer in bytes.
+ * @param policy What to do with invalid input.
+ * @return The number of bytes converted, the number of code units
+ *         written, and `EILSEQ` if invalid input was found.
+ */
+extern struct utf8_conv
+utf8_to_utf16be (uint16_t         *dst,
+                 uint8_t const    *src,
+                 size_t            len,
+                 enum utf8_policy  policy) utf8_nonnull_in;
+
+/**
+ * @brief Encode UTF-32 as UTF-8.
+ *
+ * Writes each code point in `src` to `dst` as UTF-8. Surrogates and
+ * values above U+10FFFF are invalid, as they are in UTF-8 input.
+ *
+ * Runs of eight code points below U+10000 are encoded with SSE4.2 on
+ * CPUs that have it, eight bytes at a time if they are all ASCII.
+ *
+ * @param dst    A pointer to the output buffer, with room for at least
+ *               `4 * len` bytes. Must not be null.
+ * @param src    A pointer to the input buffer. Must not be null.
+ * @param len    The number of code points in the input buffer.
+ * @param policy What to do with invalid input. With @ref utf8_replace,
+ *               each invalid code point is encoded as U+FFFD.
+ * @return The number of code points converted, the number of bytes
+ *         written, and `EILSEQ` if invalid input was found. With
+ *         @ref utf8_stop, the number of code points converted is the
+ *         index of the first invalid one.
+ */
+extern struct utf8_conv
+utf32_to_utf8 (uint8_t          *dst,
+               uint32_t const   *src,
+               size_t            len,
+               enum utf8_policy  policy) utf8_nonnull_in;
+
+/**
+ * @brief Encode little-endian UTF-16 as UTF-8.
+ *
+ * Works like @ref utf32_to_utf8(). A surrogate pair is encoded as the
+ * four-byte sequence of the code point it stands for. A surrogate
+ * which is not part of a pair is invalid; with @ref utf8_replace it
+ * is encoded as U+FFFD. Since no code unit yields more than three
+ * bytes, `3 * len` bytes of output space is always enough.
+ *
+ * @param dst    A pointer to the output buffer, with room for at least
+ *               `3 * len` bytes. Must not be null.
+ * @param src    A pointer to the input buffer. Must not be null.
+ * @param len    The number of code units in the input buffer.
+ * @param policy What to do with invalid input.
+ * @return The number of code units converted, the number of bytes
+ *         written, and `EILSEQ` if invalid input was found.
+ */
+extern struct utf8_conv
+utf16le_to_utf8 (uint8_t          *dst,
+                 uint16_t const   *src,
+                 size_t            len,
+                 enum utf8_policy  policy) utf8_nonnull_in;
+
+/**
+ * @brief Encode big-endian UTF-16 as UTF-8.
+ *
+ * Same as @ref utf16le_to_utf8(), but the code units are read in
+ * big-endian byte order.
+ *
+ * @param dst    A pointer to the output buffer, with room for at least
+ *               `3 * len` bytes. Must not be null.
+ * @param src    A pointer to the input buffer. Must not be null.
+ * @param len    The number of code units in the input buffer.
+ * @param policy What to do with invalid input.
+ * @return The number of code units converted, the number of bytes
+ *         written, and `EILSEQ` if invalid input was found.
+ */
+extern struct utf8_conv
+utf16be_to_utf8 (uint8_t          *dst,
+                 uint16_t const   *src,
+                 size_t            len,
+                 enum utf8_policy  policy) utf8_nonnull_in;
+
+/**
+ * @brief Flags for @ref utf8_sanitize().
+ */
+utf8_fixed_enum(utf8_sanitize_flags, uint8_t) {
+	/** Drop invalid input instead of substituting U+FFFD. */
+	utf8_sanitize_skip    = 1U << 0U,
+	/** Stop before a sequence cut short by the end of the input
+	 *  instead of treating it as invalid, so that the caller can
+	 *  complete it with input that isn't available yet. */
+	utf8_sanitize_partial = 1U << 1U,
+};
+
+/**
+ * @brief Copy UTF-8 with each invalid sequence replaced by U+FFFD.
+ *
+ * Valid input is copied as is. Each maximal subpart of an invalid
+ * sequence is replaced with one U+FFFD, the same as the decoders do
+ * with @ref utf8_replace, which is what the WHATWG Encoding Standard
+ * requires. The output is always valid UTF-8.
+ *
+ * The input is checked with the kernels of @ref utf8_validate() in
+ * blocks, and each run of valid input is copied with one `memcpy()`.
+ * Only blocks with errors in them are looked at byte by byte.
+ *
+ * If the output doesn't fit in `dst_cap` bytes, as many whole code
+ * points as fit are written and the error is `E2BIG`. Use
+ * @ref utf8_sanitized_size() to get the exact size needed, or make
+ * room for `3 * len` bytes, which is always enough.
+ *
+ * @param dst     A pointer to the output buffer. Must not be null.
+ * @param dst_cap The size of the output buffer in bytes.
+ * @param src     A pointer to the input buffer. Must not be null.
+ * @param len     The size of the input buffer in bytes.
+ * @param flags   A bitwise OR of @ref utf8_sanitize_flags, or 0.
+ * @return The number of bytes consumed, the number of bytes written,
+ *         and the error: `E2BIG` if the output didn't fit, otherwise
+ *         `EILSEQ` if invalid input was found, otherwise 0. Bytes are
+ *         left unconsumed only on `E2BIG` or with
+ *         @ref utf8_sanitize_partial.
+ */
+extern struct utf8_conv
+utf8_sanitize (uint8_t       *dst,
+               size_t         dst_cap,
+               uint8_t const *src,
+               size_t         len,
+               unsigned       flags) utf8_nonnull_in;
+
+/**
+ * @brief Get the exact output size of @ref utf8_sanitize().
+ *
+ * @param src   A pointer to the input buffer. Must not be null.
+ * @param len   The size of the input buffer in bytes.
+ * @param flags The flags to be passed to @ref utf8_sanitize().
+ * @return The number of bytes @ref utf8_sanitize() writes for the
+ *         same input and flags, given enough room.
+ */
+extern size_t
+utf8_sanitized_size (uint8_t const *src,
+                     size_t         len,
+                     unsigned       flags) utf8_nonnull_in;
+
+/**
+ * @brief Result of @ref utf8_display_width().
+ */
+struct utf8_width {
+	/** @brief Display width in columns of the bytes before `offset`. */
+	size_t width;
+	/** @brief `len` if the input is valid, otherwise the offset of
+	 *         the first byte of the first invalid sequence. */
+	size_t offset;
+	/** @brief 0, or `EILSEQ` if invalid input was found. */
+	int    error;
+};
+
+/**
+ * @brief Get the number of terminal columns UTF-8 text occupies.
+ *
+ * Each code point is as wide as its East Asian Width property says,
+ * with Wide and Fullwidth characters two columns and the rest one,
+ * except that nonspacing and enclosing marks, format and control
+ * characters, line and paragraph separators and conjoining Hangul
+ * vowels and trailing consonants take none. Soft hyphen and the
+ * prepended concatenation marks, which are format characters with
+ * a glyph, take one column like in glibc. Ambiguous width counts
+ * as narrow. Unlike `wcwidth()` the result doesn't depend on the
+ * locale, and control characters aren't an error; callers that lay
+ * out tabs or line breaks must handle those themselves.
+ *
+ * The widths come from a two-stage table in `utf8_width_lut.h`, which
+ * `gen-width` generates from the Unicode Character Database. Runs of
+ * printable ASCII are measured in bulk with vector instructions where
+ * available.
+ *
+ * Measuring stops at the first invalid sequence, or at a sequence cut
+ * short by the end of the input.
+ *
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param len The size of the input buffer in bytes.
+ * @return The width, the number of bytes measured and the error.
+ */
+extern struct utf8_width
+utf8_display_width (uint8_t const *ptr,
+                    size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Answers of @ref utf8_nfc_quick_check().
+ */
+utf8_fixed_enum(utf8_nfc_qc, uint8_t) {
+	/** The input is in Normalization Form C. */
+	utf8_nfc_yes,
+	/** The input is not in Normalization Form C. */
+	utf8_nfc_no,
+	/** The input may or may not be in Normalization Form C; only
+	 *  normalizing it will tell. */
+	utf8_nfc_maybe,
+};
+
+/**
+ * @brief Result of @ref utf8_nfc_quick_check().
+ */
+struct utf8_nfc {
+	/** @brief Offset of the first code point which isn't certain to
+	 *         be in NFC, or of the first invalid sequence if that
+	 *         comes first, or the input length if there is none. */
+	size_t           offset;
+	/** @brief The answer; @ref utf8_nfc_no for invalid input. */
+	enum utf8_nfc_qc result;
+	/** @brief 0, or `EILSEQ` if invalid input was found. */
+	int              error;
+};
+
+/**
+ * @brief Validate UTF-8 and run the NFC quick check algorithm on it.
+ *
+ * Implements the quick check of Unicode Standard Annex #15: the input
+ * is not in NFC if it contains a code point with NFC_Quick_Check=No
+ * or two combining marks out of canonical order, and may or may not
+ * be if it contains one with NFC_Quick_Check=Maybe. Only text with
+ * a Maybe needs to be normalized to find out, and only from the last
+ * starter before `offset` on.
+ *
+ * The input is validated like with @ref utf8_check(), a block at a
+ * time. Bytes below 0xcc can't begin a code point at or above U+0300,
+ * below which every code point is NFC_Quick_Check=Yes and of combining
+ * class 0, so runs of them are skipped with vector instructions where
+ * available. The properties of the rest come from a two-stage table
+ * in `utf8_nfc_lut.h`, which `gen-nfc` generates from the Unicode
+ * Character Database.
+ *
+ * The input is validated to the end even if the answer is known
+ * before it.
+ *
+ * @param ptr A pointer to the input buffer. Must not be null.
+ * @param len The size of the input buffer in bytes.
+ * @return The answer, the offset of the first code point that isn't
+ *         NFC_Quick_Check=Yes and the error.
+ */
+extern struct utf8_nfc
+utf8_nfc_quick_check (uint8_t const *ptr,
+                      size_t         len) utf8_nonnull_in;
+
+/**
+ * @brief Find the first occurrence of a UTF-8 string in a buffer.
+ *
+ * Works like `memmem()`, but a match can't begin or end inside a
+ * multi-byte sequence of the haystack. The needle must be valid
+ * UTF-8, so its first byte is never in the continuation byte class
+ * of the parser and every match begins on a code point boundary;
+ * the haystack needn't be validated.
+ *
+ * Candidate positions are found by comparing the first and the last
+ * byte of the needle against the haystack, 16 or 32 positions at a
+ * time with vector instructions where available, and the bytes in
+ * between are compared only for candidates. A single-byte needle is
+ * left to `memchr()`.
+ *
+ * @param ptr        A pointer to the haystack. Must not be null.
+ * @param len        The size of the haystack in bytes.
+ * @param needle     A pointer to the needle. Must not be null.
+ * @param needle_len The size of the needle in bytes.
+ * @return A pointer to the first match, `ptr` if the needle is empty,
+ *         or `nullptr` if there is no match or the needle isn't valid
+ *         UTF-8.
+ */
+extern uint8_t const *
+utf8_find (uint8_t const *ptr,
+           size_t         len,
+           uint8_t const *needle,
+           size_t         needle_len) utf8_nonnull_in;
+
+/**
+ * @brief Find the first occurrence of a code point in a buffer.
+ *
+ * Encodes `cp` and searches for it with @ref utf8_find().
+ *
+ * @param ptr A pointer to the haystack. Must not be null.
+ * @param len The size of the haystack in bytes.
+ * @param cp  The code point to find.
+ * @return A pointer to the first match, or `nullptr` if there is no
+ *         match or `cp` is a surrogate or above U+10FFFF.
+ */
+extern uint8_t const *
+utf8_find_code_point (uint8_t const *ptr,
+                      size_t         len,
+                      uint32_t       cp) utf8_nonnull_in;
+
+/**
+ * @brief Code point offset index of a buffer of valid UTF-8.
+ *
+ * Records the byte offset of every `stride`th code point, so that
+ * converting between code point and byte offsets takes a lookup and
+ * a scan over fewer than `stride` code points instead of a walk from
+ * the start of the buffer. The index takes `sizeof (size_t)` bytes per
+ * `stride` code points.
+ *
+ * The buffer is not copied and must outlive the index.
+ */
+struct utf8_index {
+	/** @brief The indexed buffer. */
+	uint8_t const *ptr;
+	/** @brief The size of the buffer in bytes. */
+	size_t         len;
+	/** @brief The number of code points in the buffer. */
+	size_t         count;
+	/** @brief Code points per index entry. */
+	size_t         stride;
+	/** @brief The byte offset of code point `i * stride` for each
+	 *         `i < (count + stride - 1) / stride`. */
+	size_t        *offsets;
+};
+
+/**
+ * @brief Build a code point offset index.
+ *
+ * Counts the bytes which are not continuation bytes, as
+ * @ref utf8_count_code_points() does, in a single pass over the
+ * buffer with vector instructions where available. The input is not
+ * validated.
+ *
+ * @param idx    A pointer to the index to initialize. Must not be null.
+ * @param ptr    A pointer to the input buffer. Must not be null.
+ * @param len    The size of the input buffer in bytes.
+ * @param stride Code points per index entry. Larger values make the
+ *               index smaller and the queries slower.
+ * @return 0 on success, `EINVAL` if `stride` is 0, or `ENOMEM`.
+ *
+ * @public @memberof utf8_index
+ */
+extern int
+utf8_index_build (struct utf8_index *idx,
+                  uint8_t const     *ptr,
+                  size_t             len,
+                  size_t             stride) utf8_nonnull_in;
+
+/**
+ * @brief Free the memory of a code point offset index.
+ *
+ * @param idx A pointer to an index initialized with
+ *            @ref utf8_index_build(). Must not be null.
+ *
+ * @public @memberof utf8_index
+ */
+extern void
+utf8_index_free (struct utf8_index *idx) utf8_nonnull_in;
+
+/**
+ * @brief Get the byte offset of a code point.
+ *
+ * @param idx A pointer to the index. Must not be null.
+ * @param n   The number of code points before the one to look up.
+ * @return The byte offset of code point `n`, or `idx->len` if `n` is
+ *         not less than `idx->count`.
+ *
+ * @public @memberof utf8_index
+ */
+extern size_t
+utf8_index_byte_offset (struct utf8_index const *idx,
+                        size_t                   n) utf8_nonnull_in;
+
+/**
+ * @brief Get the code point offset of a byte.
+ *
+ * @param idx    A pointer to the index. Must not be null.
+ * @param offset A byte offset into the buffer.
+ * @return The number of code points before the one which the byte at
+ *         `offset` belongs to, or `idx->count` if `offset` is not less
+ *         than `idx->len`.
+ *
+ * @public @memberof utf8_index
+ */
+extern size_t
+utf8_index_char_offset (struct utf8_index const *idx,
+                        size_t                   offset) utf8_nonnull_in;
+
+#ifdef UTF8_PROFILE
+/**
+ * @brief State machine profiling counters.
+ *
+ * Only available in builds with `UTF8_PROFILE` defined. Each thread
+ * has its own set of counters, updated by the byte-at-a-time state
+ * machine of @ref utf8_parse_next_code_point(), @ref utf8_parse_span()
+ * and @ref utf8_parse_span_dfa(). The bulk APIs use the state machine
+ * only on input their vector kernels reject, and the kernels count
+ * nothing.
+ *
+ * Counters are indexed by @ref utf8_st8 enumerations. The first byte
+ * after @ref utf8_ini is counted as if it followed @ref utf8_asc, the
+ * state @ref utf8_ini shares its transitions with.
+ */
+struct utf8_profile {
+	/** @brief Accepted bytes by state before and state after. */
+	uint64_t transitions[16][16];
+	/** @brief Rejected bytes by the state that rejected them. */
+	uint64_t errors[16];
+	/** @brief Bytes of complete code points by sequence length - 1. */
+	uint64_t bytes[4];
+};
+
+/**
+ * @brief Copy the calling thread's profiling counters.
+ *
+ * @param dst Where to store the counters. Must not be null.
+ */
+extern void
+utf8_profile_get (struct utf8_profile *dst) utf8_nonnull_in;
+
+/**
+ * @brief Zero the calling thread's profiling counters.
+ */
+extern void
+utf8_profile_reset (void);
+#endif /* UTF8_PROFILE */
+
+/**
+ * @brief Get the name of the instruction set used by the bulk kernels.
+ *
+ * The kernel variant is picked on first use as the widest one the CPU
+ * supports: `"avx512"` (AVX-512BW and VBMI), `"avx2"`, `"sse4.2"`, or
+ * `"scalar"`. Setting the `UTF8_KERNEL` environment variable to one of
+ * these names forces that variant instead, provided that the CPU can
+ * run it.
+ *
+ * @return The name of the selected kernel variant.
+ */
+utf8_nonnull_out
+extern char const *
+utf8_kernel (void);
+
 /* Private macro cleanup logic depends on this include being here,
  * right above the closing endif of the header guard. DO NOT MOVE.
  */
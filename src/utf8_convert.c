@@ -0,0 +1,975 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_convert.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#ifdef _WIN32
+# define _CRT_SECURE_NO_WARNINGS
+# define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <threads.h>
+
+#include "utf8_cpu.h"
+#include "utf8_lut.h"
+#include "utf8_vec.h"
+
+/** U+FFFD REPLACEMENT CHARACTER */
+constexpr static const uint32_t utf8_replacement = 0xfffdU;
+
+/**
+ * @brief Output encodings of the UTF-8 decoder.
+ */
+enum utf8_form {
+	utf8_form_utf32,   //!< `uint32_t` code points, native byte order.
+	utf8_form_utf16le, //!< `uint16_t` code units, little-endian.
+	utf8_form_utf16be, //!< `uint16_t` code units, big-endian.
+};
+
+/**
+ * @brief Put a UTF-16 code unit in the byte order of `form`.
+ */
+utf8_const_inline uint16_t
+utf8_utf16_unit (uint32_t       u,
+                 enum utf8_form form)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return form == utf8_form_utf16le ? __builtin_bswap16((uint16_t)u)
+	                                 : (uint16_t)u;
+#else
+	return form == utf8_form_utf16be ? __builtin_bswap16((uint16_t)u)
+	                                 : (uint16_t)u;
+#endif
+}
+
+/**
+ * @brief Write a code point to `dst` at index `i` in the encoding
+ *        given by `form`, as a surrogate pair if needed.
+ *
+ * @return The index after the code units written.
+ */
+utf8_force_inline size_t
+utf8_put (void *const    dst,
+          size_t         i,
+          uint32_t       cp,
+          enum utf8_form form)
+{
+	if (form == utf8_form_utf32) {
+		((uint32_t *)dst)[i] = cp;
+		return i + 1U;
+	}
+
+	uint16_t *const d = dst;
+	if (cp < 0x10000U) {
+		d[i] = utf8_utf16_unit(cp, form);
+		return i + 1U;
+	}
+
+	cp -= 0x10000U;
+	d[i] = utf8_utf16_unit(0xd800U | cp >> 10U, form);
+	d[i + 1U] = utf8_utf16_unit(0xdc00U | (cp & 0x3ffU), form);
+	return i + 2U;
+}
+
+/**
+ * @brief Decode one code point by walking the state transition tables.
+ *
+ * @param ptr Address of the first byte of the sequence, less than `end`.
+ * @param end End of the input.
+ * @param cp  Receives the code point if the sequence is valid.
+ * @return The length of the sequence if it is valid, otherwise minus
+ *         the length of its maximal subpart, which is the number of
+ *         bytes one U+FFFD stands for.
+ */
+static int
+utf8_decode_one (uint8_t const *const ptr,
+                 uint8_t const *const end,
+                 uint32_t      *const cp)
+{
+	constexpr static const uint8_t utf8_len[16] = {
+		//! @cond
+		#define F(n,m,l,...) [n] = l,
+		//! @endcond
+		UTF8_PARSER_DESCRIPTOR(F)
+		//! @cond
+		#undef F
+		//! @endcond
+	};
+
+	uint16_t bit = utf8_lut[*ptr] & utf8_dst[utf8_ini];
+	if (!bit)
+		return -1;
+
+	unsigned st8 = (unsigned)__builtin_ctz(bit);
+	int len = utf8_len[st8];
+	uint32_t c = len > 1 ? *ptr & (0xffU >> (len + 1)) : *ptr;
+
+	for (int i = 1; i < len; ++i) {
+		if (&ptr[i] == end || !(bit = utf8_lut[ptr[i]] & utf8_dst[st8]))
+			return -i;
+		st8 = (unsigned)__builtin_ctz(bit);
+		c = c << 6U | (ptr[i] & 0x3fU);
+	}
+
+	*cp = c;
+	return len;
+}
+
+#ifdef UTF8_SIMD
+/**
+ * @brief Decode input which a vector kernel has found to be valid.
+ *
+ * `[ptr, end)` must hold only complete, valid sequences. ASCII runs
+ * are widened in bulk; the sequence lengths of other leading bytes
+ * come from the bounds in the kernel tables.
+ *
+ * @return The output index after the code units written.
+ */
+utf8_force_inline size_t
+utf8_decode_valid (struct utf8_vec_lut const *const v,
+                   void                      *const dst,
+                   size_t                           i,
+                   uint8_t const                   *ptr,
+                   uint8_t const             *const end,
+                   enum utf8_form                   form)
+{
+	while (ptr < end) {
+		size_t n = utf8_ascii_run(ptr, end);
+		if (form == utf8_form_utf32) {
+			uint32_t *const d = &((uint32_t *)dst)[i];
+			for (size_t k = 0; k < n; ++k)
+				d[k] = ptr[k];
+		} else {
+			uint16_t *const d = &((uint16_t *)dst)[i];
+			for (size_t k = 0; k < n; ++k)
+				d[k] = utf8_utf16_unit(ptr[k], form);
+		}
+		i += n;
+		ptr += n;
+		if (ptr == end)
+			break;
+
+		uint32_t b = *ptr;
+		if (b <= v->need[1]) {
+			i = utf8_put(dst, i, (b & 0x1fU) << 6U
+			                   | (ptr[1] & 0x3fU), form);
+			ptr += 2;
+		} else if (b <= v->need[2]) {
+			i = utf8_put(dst, i, (b & 0x0fU) << 12U
+			                   | (ptr[1] & 0x3fU) << 6U
+			                   | (ptr[2] & 0x3fU), form);
+			ptr += 3;
+		} else {
+			i = utf8_put(dst, i, (b & 0x07U) << 18U
+			                   | (ptr[1] & 0x3fU) << 12U
+			                   | (ptr[2] & 0x3fU) << 6U
+			                   | (ptr[3] & 0x3fU), form);
+			ptr += 4;
+		}
+	}
+
+	return i;
+}
+#endif /* UTF8_SIMD */
+
+#ifdef UTF8_SIMD
+/**
+ * @brief Shuffle table for the vector decoder.
+ *
+ * Indexed by a 12-bit mask with bit `i` set if input byte `i` is the
+ * last byte of a code point. Each entry gathers the bytes of the first
+ * four code points into one 32-bit lane each, last byte lowest, and
+ * tells how many bytes and code points that is.
+ */
+static struct utf8_dec_lut {
+	/** `pshufb` control, 0x80 for bytes outside the code point. */
+	uint8_t shuf[4096][16];
+	/** Bytes consumed in bits 0-3, code points in bits 4-7. */
+	uint8_t step[4096];
+} utf8_dec;
+
+static once_flag utf8_dec_once = ONCE_FLAG_INIT;
+
+static void
+utf8_dec_init (void)
+{
+	for (unsigned m = 0; m < 4096U; ++m) {
+		unsigned beg = 0, j = 0;
+		__builtin_memset(utf8_dec.shuf[m], 0x80, 16U);
+
+		for (unsigned i = 0; i < 12U && j < 4U; ++i) {
+			if (!(m >> i & 1U))
+				continue;
+			unsigned n = i + 1U - beg;
+			if (n > 4U)
+				break; // Can't come from valid input
+			for (unsigned k = 0; k < n; ++k)
+				utf8_dec.shuf[m][j * 4U + k] = (uint8_t)(i - k);
+			beg = i + 1U;
+			++j;
+		}
+
+		utf8_dec.step[m] = (uint8_t)(beg | j << 4U);
+	}
+}
+
+utf8_target_push("sse4.2")
+
+/**
+ * @brief Decode valid input four code points at a time.
+ *
+ * Same contract as @ref utf8_decode_valid(). ASCII is widened up to
+ * 16 bytes at a time. Otherwise the ends of the code points in the
+ * next 12 bytes select a @ref utf8_dec_lut entry, the leading and
+ * continuation markers are masked off each byte based on its high
+ * nibble, the shuffle brings each code point's payload bits to its
+ * own lane, and two multiply-adds merge them.
+ */
+utf8_force_inline size_t
+utf8_decode_valid_sse42 (struct utf8_vec_lut const *const v,
+                         void                      *const dst,
+                         size_t                           i,
+                         uint8_t const                   *ptr,
+                         uint8_t const             *const end,
+                         enum utf8_form                   form)
+{
+	__m128i const bits = _mm_setr_epi8(0x7f, 0x7f, 0x7f, 0x7f,
+	                                   0x7f, 0x7f, 0x7f, 0x7f,
+	                                   0x3f, 0x3f, 0x3f, 0x3f,
+	                                   0x1f, 0x1f, 0x0f, 0x07);
+	__m128i const swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+	                                   9, 8, 11, 10, 13, 12, 15, 14);
+	bool const bswap = form == utf8_form_utf16be;
+
+	while (end - ptr >= 64) {
+		// Masks of the bytes which are not ASCII and of those which
+		// are not continuation bytes, so that the steps below only
+		// have a shift and a table lookup in their dependency chain
+		uint64_t hi = 0, nc = 0;
+		for (unsigned k = 0; k < 4U; ++k) {
+			__m128i in = _mm_loadu_si128((__m128i const *)&ptr[k * 16U]);
+			hi |= (uint64_t)(uint16_t)_mm_movemask_epi8(in) << (k * 16U);
+			nc |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+				_mm_cmpgt_epi8(in, _mm_set1_epi8(-65))) << (k * 16U);
+		}
+
+		unsigned pos = 0;
+		while (pos <= 48U) {
+			__m128i in = _mm_loadu_si128((__m128i const *)&ptr[pos]);
+
+			// Widen an ASCII prefix of at least four bytes; all of
+			// the 16 bytes are written, but only the prefix counts
+			unsigned a = (unsigned)__builtin_ctz((uint32_t)(uint16_t)(hi >> pos)
+			                                     | 0x10000U);
+			if (a >= 4U) {
+				if (form == utf8_form_utf32) {
+					uint32_t *const d = &((uint32_t *)dst)[i];
+					_mm_storeu_si128((__m128i *)&d[0], _mm_cvtepu8_epi32(in));
+					_mm_storeu_si128((__m128i *)&d[4], _mm_cvtepu8_epi32(
+						_mm_srli_si128(in, 4)));
+					_mm_storeu_si128((__m128i *)&d[8], _mm_cvtepu8_epi32(
+						_mm_srli_si128(in, 8)));
+					_mm_storeu_si128((__m128i *)&d[12], _mm_cvtepu8_epi32(
+						_mm_srli_si128(in, 12)));
+				} else {
+					__m128i lo = _mm_unpacklo_epi8(in, _mm_setzero_si128());
+					__m128i up = _mm_unpackhi_epi8(in, _mm_setzero_si128());
+					if (bswap) {
+						lo = _mm_shuffle_epi8(lo, swap);
+						up = _mm_shuffle_epi8(up, swap);
+					}
+					uint16_t *const d = &((uint16_t *)dst)[i];
+					_mm_storeu_si128((__m128i *)&d[0], lo);
+					_mm_storeu_si128((__m128i *)&d[8], up);
+				}
+				i += a;
+				pos += a;
+				continue;
+			}
+
+			unsigned m = (unsigned)(nc >> (pos + 1U)) & 0xfffU;
+			unsigned step = utf8_dec.step[m];
+			unsigned len = step & 0x0fU;
+			unsigned num = step >> 4U;
+
+			__m128i x = _mm_and_si128(in, _mm_shuffle_epi8(bits,
+				_mm_and_si128(_mm_srli_epi16(in, 4), _mm_set1_epi8(0x0f))));
+			x = _mm_shuffle_epi8(x, _mm_loadu_si128(
+				(__m128i const *)utf8_dec.shuf[m]));
+			x = _mm_maddubs_epi16(x, _mm_set1_epi16(0x4001));
+			x = _mm_madd_epi16(x, _mm_set1_epi32(0x10000001));
+
+			if (form == utf8_form_utf32) {
+				_mm_storeu_si128((__m128i *)&((uint32_t *)dst)[i], x);
+			} else if (_mm_movemask_epi8(_mm_cmpgt_epi32(
+					x, _mm_set1_epi32(0xffff)))) {
+				// Surrogate pairs needed
+				i = utf8_decode_valid(v, dst, i, &ptr[pos],
+				                      &ptr[pos + len], form);
+				pos += len;
+				continue;
+			} else {
+				x = _mm_packus_epi32(x, x);
+				if (bswap)
+					x = _mm_shuffle_epi8(x, swap);
+				_mm_storel_epi64((__m128i *)&((uint16_t *)dst)[i], x);
+			}
+
+			i += num;
+			pos += len;
+		}
+
+		ptr += pos;
+	}
+
+	return utf8_decode_valid(v, dst, i, ptr, end, form);
+}
+
+static size_t
+utf8_decode_valid_utf32 (struct utf8_vec_lut const *const v,
+                         void                      *const dst,
+                         size_t                           i,
+                         uint8_t const                   *ptr,
+                         uint8_t const             *const end)
+{
+	return utf8_decode_valid_sse42(v, dst, i, ptr, end, utf8_form_utf32);
+}
+
+static size_t
+utf8_decode_valid_utf16le (struct utf8_vec_lut const *const v,
+                           void                      *const dst,
+                           size_t                           i,
+                           uint8_t const                   *ptr,
+                           uint8_t const             *const end)
+{
+	return utf8_decode_valid_sse42(v, dst, i, ptr, end, utf8_form_utf16le);
+}
+
+static size_t
+utf8_decode_valid_utf16be (struct utf8_vec_lut const *const v,
+                           void                      *const dst,
+                           size_t                           i,
+                           uint8_t const                   *ptr,
+                           uint8_t const             *const end)
+{
+	return utf8_decode_valid_sse42(v, dst, i, ptr, end, utf8_form_utf16be);
+}
+
+utf8_target_pop()
+#endif /* UTF8_SIMD */
+
+/**
+ * @brief Decode UTF-8 into the encoding given by `form`.
+ *
+ * Inlined into each public converter with a constant `form`.
+ */
+utf8_force_inline struct utf8_conv
+utf8_decode (void *const      dst,
+             uint8_t const   *src,
+             size_t           len,
+             enum utf8_policy policy,
+             enum utf8_form   form)
+{
+	uint8_t const *const beg = src;
+	uint8_t const *const end = src + len;
+	size_t out = 0;
+	int error = 0;
+
+#ifdef UTF8_SIMD
+	struct utf8_vec_lut const *const v = utf8_vec_get();
+	if (v->fn)
+		call_once(&utf8_dec_once, utf8_dec_init);
+#endif /* UTF8_SIMD */
+
+	// Work in blocks which start small and grow while the input is
+	// valid, so that an error costs at most one block of rework.
+	for (size_t max = 64U; src < end;) {
+		size_t n = (size_t)(end - src);
+		if (n > max)
+			n = max;
+
+#ifdef UTF8_SIMD
+		if (v->fn) {
+			uint32_t carry = 0;
+			size_t k;
+			if (v->fn(v, src, n, &carry, &k)) {
+				// Leave an incomplete sequence at the end
+				// of the block to the next one
+				uint8_t const *stop = &src[n];
+				if (!utf8_vec_done(v, carry)) {
+					do --stop;
+					while (stop > src && v->cont[*stop >> 4U]);
+				}
+
+				if (stop > src) {
+					out = form == utf8_form_utf32
+					    ? utf8_decode_valid_utf32(v, dst, out, src, stop)
+					    : form == utf8_form_utf16le
+					    ? utf8_decode_valid_utf16le(v, dst, out, src, stop)
+					    : utf8_decode_valid_utf16be(v, dst, out, src, stop);
+					src = stop;
+					if (max < utf8_vec_block)
+						max <<= 1U;
+					continue;
+				}
+			}
+			max = 64U;
+		}
+#endif /* UTF8_SIMD */
+
+		// Decode the block with the state machine, which finds
+		// the maximal subpart of each invalid sequence
+		for (uint8_t const *const stop = &src[n]; src < stop;) {
+			uint32_t cp;
+			int r = utf8_decode_one(src, end, &cp);
+			if (r > 0) {
+				out = utf8_put(dst, out, cp, form);
+				src += r;
+				continue;
+			}
+
+			error = EILSEQ;
+			if (policy == utf8_stop)
+				goto done;
+
+			out = utf8_put(dst, out, utf8_replacement, form);
+			src -= r;
+		}
+	}
+
+done:
+	return (struct utf8_conv) {
+		.in    = (size_t)(src - beg),
+		.out   = out,
+		.error = error,
+	};
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf8_to_utf32 (uint32_t *const  dst,
+               uint8_t const   *src,
+               size_t           len,
+               enum utf8_policy policy)
+{
+	return utf8_decode(dst, src, len, policy, utf8_form_utf32);
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf8_to_utf16le (uint16_t *const  dst,
+                 uint8_t const   *src,
+                 size_t           len,
+                 enum utf8_policy policy)
+{
+	return utf8_decode(dst, src, len, policy, utf8_form_utf16le);
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf8_to_utf16be (uint16_t *const  dst,
+                 uint8_t const   *src,
+                 size_t           len,
+                 enum utf8_policy policy)
+{
+	return utf8_decode(dst, src, len, policy, utf8_form_utf16be);
+}
+
+/**
+ * @brief Read the code unit at index `i` of `src` in the encoding
+ *        given by `form`.
+ */
+utf8_force_inline uint32_t
+utf8_get (void const *const src,
+          size_t            i,
+          enum utf8_form    form)
+{
+	if (form == utf8_form_utf32)
+		return ((uint32_t const *)src)[i];
+	return utf8_utf16_unit(((uint16_t const *)src)[i], form);
+}
+
+/**
+ * @brief Write a code point to `dst` at offset `o` as UTF-8.
+ *
+ * @return The offset after the bytes written.
+ */
+utf8_force_inline size_t
+utf8_put_utf8 (uint8_t *const dst,
+               size_t         o,
+               uint32_t       cp)
+{
+	if (cp < 0x80U) {
+		dst[o] = (uint8_t)cp;
+		return o + 1U;
+	}
+
+	if (cp < 0x800U) {
+		dst[o    ] = (uint8_t)(0xc0U | cp >> 6U);
+		dst[o + 1] = (uint8_t)(0x80U | (cp & 0x3fU));
+		return o + 2U;
+	}
+
+	if (cp < 0x10000U) {
+		dst[o    ] = (uint8_t)(0xe0U | cp >> 12U);
+		dst[o + 1] = (uint8_t)(0x80U | (cp >> 6U & 0x3fU));
+		dst[o + 2] = (uint8_t)(0x80U | (cp & 0x3fU));
+		return o + 3U;
+	}
+
+	dst[o    ] = (uint8_t)(0xf0U | cp >> 18U);
+	dst[o + 1] = (uint8_t)(0x80U | (cp >> 12U & 0x3fU));
+	dst[o + 2] = (uint8_t)(0x80U | (cp >> 6U & 0x3fU));
+	dst[o + 3] = (uint8_t)(0x80U | (cp & 0x3fU));
+	return o + 4U;
+}
+
+#ifdef UTF8_SIMD
+/**
+ * @brief Compaction table for the vector encoder.
+ *
+ * Indexed by two 4-bit masks, of the lanes holding at least two and
+ * three byte sequences. Each entry packs the used bytes of four 32-bit
+ * lanes together and tells how many bytes that is.
+ */
+static struct utf8_enc_lut {
+	/** `pshufb` control, 0x80 past the end of the output. */
+	uint8_t shuf[256][16];
+	/** Bytes of output. */
+	uint8_t len[256];
+} utf8_enc;
+
+static once_flag utf8_enc_once = ONCE_FLAG_INIT;
+
+static void
+utf8_enc_init (void)
+{
+	for (unsigned m = 0; m < 256U; ++m) {
+		unsigned o = 0;
+		__builtin_memset(utf8_enc.shuf[m], 0x80, 16U);
+
+		for (unsigned j = 0; j < 4U; ++j) {
+			unsigned n = 1U + (m >> j & 1U) + (m >> (j + 4U) & 1U);
+			for (unsigned k = 0; k < n; ++k)
+				utf8_enc.shuf[m][o++] = (uint8_t)(j * 4U + k);
+		}
+
+		utf8_enc.len[m] = (uint8_t)o;
+	}
+}
+
+utf8_target_push("sse4.2")
+
+/**
+ * @brief Encode four BMP code points in 32-bit lanes as UTF-8.
+ *
+ * Each lane is encoded as a one, two and three byte sequence, the
+ * right one is picked by blending, and @ref utf8_enc_lut squeezes
+ * out the unused bytes. Always stores 16 bytes.
+ *
+ * @return The number of bytes of output.
+ */
+utf8_force_inline unsigned
+utf8_encode_bmp4 (uint8_t *const dst,
+                  __m128i        c)
+{
+	__m128i const m6 = _mm_set1_epi32(0x3f);
+	__m128i const lo = _mm_or_si128(_mm_and_si128(c, m6),
+	                                _mm_set1_epi32(0x80));
+	__m128i const mid = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(c, 6), m6),
+	                                 _mm_set1_epi32(0x80));
+
+	__m128i two = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(c, 6),
+	                                        _mm_set1_epi32(0xc0)),
+	                           _mm_slli_epi32(lo, 8));
+	__m128i three = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(c, 12),
+	                                          _mm_set1_epi32(0xe0)),
+	                             _mm_or_si128(_mm_slli_epi32(mid, 8),
+	                                          _mm_slli_epi32(lo, 16)));
+
+	__m128i ge2 = _mm_cmpgt_epi32(c, _mm_set1_epi32(0x7f));
+	__m128i ge3 = _mm_cmpgt_epi32(c, _mm_set1_epi32(0x7ff));
+	__m128i x = _mm_blendv_epi8(_mm_blendv_epi8(c, two, ge2), three, ge3);
+
+	unsigned m = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(ge2))
+	           | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(ge3)) << 4U;
+	_mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(x,
+		_mm_loadu_si128((__m128i const *)utf8_enc.shuf[m])));
+	return utf8_enc.len[m];
+}
+
+/**
+ * @brief Encode as much of the input as possible eight code units
+ *        at a time.
+ *
+ * Stops before the first block of eight which has a surrogate or,
+ * for UTF-32, a code point above U+FFFF in it, and leaves the rest
+ * to the scalar encoder. Blocks of ASCII are narrowed as such.
+ *
+ * @param dst  The output buffer.
+ * @param o    The output offset, updated.
+ * @param src  The input buffer.
+ * @param i    The input index.
+ * @param len  The length of the input.
+ * @param form The input encoding.
+ * @return The input index after the code units encoded.
+ */
+utf8_force_inline size_t
+utf8_encode_sse42 (uint8_t *const    dst,
+                   size_t     *const o,
+                   void const *const src,
+                   size_t            i,
+                   size_t const      len,
+                   enum utf8_form    form)
+{
+	__m128i const swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+	                                   9, 8, 11, 10, 13, 12, 15, 14);
+	size_t n = *o;
+
+	for (; len - i >= 8U; i += 8U) {
+		__m128i u;
+		if (form == utf8_form_utf32) {
+			uint32_t const *const p = &((uint32_t const *)src)[i];
+			__m128i a = _mm_loadu_si128((__m128i const *)&p[0]);
+			__m128i b = _mm_loadu_si128((__m128i const *)&p[4]);
+			__m128i const max = _mm_set1_epi32(0xffff);
+			if (!_mm_test_all_ones(_mm_cmpeq_epi32(
+				_mm_max_epu32(_mm_or_si128(a, b), max), max)))
+				break;
+			u = _mm_packus_epi32(a, b);
+		} else {
+			u = _mm_loadu_si128((__m128i const *)
+			                    &((uint16_t const *)src)[i]);
+			if (form == utf8_form_utf16be)
+				u = _mm_shuffle_epi8(u, swap);
+		}
+
+		if (!_mm_test_all_zeros(u, _mm_set1_epi16((short)0xff80))) {
+			__m128i sur = _mm_cmpeq_epi16(
+				_mm_and_si128(u, _mm_set1_epi16((short)0xf800)),
+				_mm_set1_epi16((short)0xd800));
+			if (!_mm_test_all_zeros(sur, sur))
+				break;
+
+			// The output so far is at most 3 bytes per input
+			// unit, and the second 16-byte store can end up to
+			// 28 bytes past it. Near the end of the input that
+			// is past the 3 * len bytes promised to be enough,
+			// so the last blocks are staged in a local buffer.
+			uint8_t tmp[32];
+			uint8_t *const out = len - i >= 10U ? &dst[n] : tmp;
+			unsigned k = utf8_encode_bmp4(out, _mm_cvtepu16_epi32(u));
+			k += utf8_encode_bmp4(&out[k], _mm_unpackhi_epi16(
+				u, _mm_setzero_si128()));
+			if (out == tmp)
+				memcpy(&dst[n], tmp, k);
+			n += k;
+			continue;
+		}
+
+		_mm_storel_epi64((__m128i *)&dst[n], _mm_packus_epi16(u, u));
+		n += 8U;
+	}
+
+	*o = n;
+	return i;
+}
+
+static size_t
+utf8_encode_utf32 (uint8_t *const    dst,
+                   size_t     *const o,
+                   void const *const src,
+                   size_t            i,
+                   size_t const      len)
+{
+	return utf8_encode_sse42(dst, o, src, i, len, utf8_form_utf32);
+}
+
+static size_t
+utf8_encode_utf16le (uint8_t *const    dst,
+                     size_t     *const o,
+                     void const *const src,
+                     size_t            i,
+                     size_t const      len)
+{
+	return utf8_encode_sse42(dst, o, src, i, len, utf8_form_utf16le);
+}
+
+static size_t
+utf8_encode_utf16be (uint8_t *const    dst,
+                     size_t     *const o,
+                     void const *const src,
+                     size_t            i,
+                     size_t const      len)
+{
+	return utf8_encode_sse42(dst, o, src, i, len, utf8_form_utf16be);
+}
+
+utf8_target_pop()
+#endif /* UTF8_SIMD */
+
+/**
+ * @brief Encode the encoding given by `form` as UTF-8.
+ *
+ * Inlined into each public converter with a constant `form`.
+ */
+utf8_force_inline struct utf8_conv
+utf8_encode (uint8_t *const   dst,
+             void const      *src,
+             size_t           len,
+             enum utf8_policy policy,
+             enum utf8_form   form)
+{
+	size_t i = 0, o = 0;
+	int error = 0;
+
+#ifdef UTF8_SIMD
+	bool const vec = utf8_cpu_isa() >= utf8_isa_sse42;
+	if (vec)
+		call_once(&utf8_enc_once, utf8_enc_init);
+#endif /* UTF8_SIMD */
+
+	while (i < len) {
+#ifdef UTF8_SIMD
+		if (vec) {
+			i = form == utf8_form_utf32
+			  ? utf8_encode_utf32(dst, &o, src, i, len)
+			  : form == utf8_form_utf16le
+			  ? utf8_encode_utf16le(dst, &o, src, i, len)
+			  : utf8_encode_utf16be(dst, &o, src, i, len);
+			if (i == len)
+				break;
+		}
+#endif /* UTF8_SIMD */
+
+		// Encode up to the next vector block boundary, so that
+		// a surrogate doesn't throw the rest of the input off
+		// the fast path
+		for (size_t stop = len - i > 8U ? i + 8U : len; i < stop;) {
+			uint32_t cp = utf8_get(src, i, form);
+			size_t n = 1;
+
+			// The descriptor admits neither surrogates nor values
+			// above U+10FFFF, and neither is encoded here
+			if ((cp & ~UINT32_C(0x7ff)) == 0xd800U) {
+				uint32_t lo;
+				if (form == utf8_form_utf32 || cp > 0xdbffU
+				    || i + 1U == len
+				    || ((lo = utf8_get(src, i + 1U, form)) & ~0x3ffU) != 0xdc00U)
+					goto invalid;
+				cp = 0x10000U + ((cp & 0x3ffU) << 10U | (lo & 0x3ffU));
+				n = 2;
+			} else if (cp > 0x10ffffU) {
+				goto invalid;
+			}
+
+			o = utf8_put_utf8(dst, o, cp);
+			i += n;
+			continue;
+
+		invalid:
+			error = EILSEQ;
+			if (policy == utf8_stop)
+				goto done;
+			o = utf8_put_utf8(dst, o, utf8_replacement);
+			++i;
+		}
+	}
+
+done:
+	return (struct utf8_conv) {
+		.in    = i,
+		.out   = o,
+		.error = error,
+	};
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf32_to_utf8 (uint8_t *const   dst,
+               uint32_t const  *src,
+               size_t           len,
+               enum utf8_policy policy)
+{
+	return utf8_encode(dst, src, len, policy, utf8_form_utf32);
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf16le_to_utf8 (uint8_t *const   dst,
+                 uint16_t const  *src,
+                 size_t           len,
+                 enum utf8_policy policy)
+{
+	return utf8_encode(dst, src, len, policy, utf8_form_utf16le);
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf16be_to_utf8 (uint8_t *const   dst,
+                 uint16_t const  *src,
+                 size_t           len,
+                 enum utf8_policy policy)
+{
+	return utf8_encode(dst, src, len, policy, utf8_form_utf16be);
+}
+
+/**
+ * @brief Copy a run of valid input to `dst` at offset `*out`, or as
+ *        many whole code points of it as fit in `cap` bytes.
+ *
+ * Doesn't write if `dst` is null.
+ *
+ * @return The end of the input copied.
+ */
+utf8_force_inline uint8_t const *
+utf8_sanitize_run (uint8_t *const       dst,
+                   size_t const         cap,
+                   size_t        *const out,
+                   uint8_t const *const run,
+                   uint8_t const *const end)
+{
+	size_t k = (size_t)(end - run);
+	if (k > cap - *out) {
+		k = cap - *out;
+		while (k && (run[k] & 0xc0U) == 0x80U)
+			--k;
+	}
+
+	if (dst)
+		(void)__builtin_memcpy(&dst[*out], run, k);
+	*out += k;
+	return &run[k];
+}
+
+/**
+ * @brief Copy UTF-8 to `dst`, replacing or dropping invalid input.
+ *
+ * Inlined into @ref utf8_sanitize() and, with a null `dst`, into
+ * @ref utf8_sanitized_size(), so that both always agree.
+ */
+utf8_force_inline struct utf8_conv
+utf8_sanitize_impl (uint8_t *const dst,
+                    size_t const   cap,
+                    uint8_t const *src,
+                    size_t         len,
+                    unsigned       flags)
+{
+	uint8_t const *const beg = src;
+	uint8_t const *const end = src + len;
+	uint8_t const *run = src; // Start of valid input not copied yet
+	size_t out = 0;
+	int error = 0;
+
+#ifdef UTF8_SIMD
+	struct utf8_vec_lut const *const v = utf8_vec_get();
+#endif /* UTF8_SIMD */
+
+	// Valid input is only skipped over, and copied in one go when
+	// an invalid sequence or the end of the input is reached
+	for (size_t max = 64U; src < end;) {
+		size_t n = (size_t)(end - src);
+		if (n > max)
+			n = max;
+
+#ifdef UTF8_SIMD
+		if (v->fn) {
+			uint32_t carry = 0;
+			size_t k;
+			if (v->fn(v, src, n, &carry, &k)) {
+				uint8_t const *stop = &src[n];
+				if (!utf8_vec_done(v, carry)) {
+					do --stop;
+					while (stop > src && v->cont[*stop >> 4U]);
+				}
+
+				if (stop > src) {
+					src = stop;
+					if (max < utf8_vec_block)
+						max <<= 1U;
+					continue;
+				}
+			}
+			max = 64U;
+		}
+#endif /* UTF8_SIMD */
+
+		for (uint8_t const *const stop = &src[n]; src < stop;) {
+			if (*src < 0x80U) {
+				++src;
+				continue;
+			}
+
+			uint32_t cp;
+			int r = utf8_decode_one(src, end, &cp);
+			if (r > 0) {
+				src += r;
+				continue;
+			}
+
+			// A sequence cut short by the end of the input, as
+			// opposed to one with an invalid byte in it
+			if ((flags & utf8_sanitize_partial) && src - r == end
+			    && (r < -1 || (utf8_lut[*src] & utf8_dst[utf8_ini])))
+				goto done;
+
+			run = utf8_sanitize_run(dst, cap, &out, run, src);
+			if (run != src || (!(flags & utf8_sanitize_skip)
+			                   && cap - out < 3U)) {
+				error = E2BIG;
+				goto full;
+			}
+
+			error = EILSEQ;
+			if (!(flags & utf8_sanitize_skip)) {
+				if (dst) {
+					dst[out    ] = 0xefU;
+					dst[out + 1] = 0xbfU;
+					dst[out + 2] = 0xbdU;
+				}
+				out += 3U;
+			}
+
+			src -= r;
+			run = src;
+		}
+	}
+
+done:
+	run = utf8_sanitize_run(dst, cap, &out, run, src);
+	if (run != src)
+		error = E2BIG;
+
+full:
+	return (struct utf8_conv) {
+		.in    = (size_t)(run - beg),
+		.out   = out,
+		.error = error,
+	};
+}
+
+utf8_nonnull_in
+struct utf8_conv
+utf8_sanitize (uint8_t *const dst,
+               size_t         dst_cap,
+               uint8_t const *src,
+               size_t         len,
+               unsigned       flags)
+{
+	return utf8_sanitize_impl(dst, dst_cap, src, len, flags);
+}
+
+utf8_nonnull_in
+size_t
+utf8_sanitized_size (uint8_t const *src,
+                     size_t         len,
+                     unsigned       flags)
+{
+	return utf8_sanitize_impl(nullptr, SIZE_MAX, src, len, flags).out;
+}
+
+#endif /* !__cplusplus */
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_cpu.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#ifdef _WIN32
+# define _CRT_SECURE_NO_WARNINGS
+# define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "utf8_cpu.h"
+
+static enum utf8_isa utf8_isa_sel = utf8_isa_scalar;
+
+static once_flag utf8_isa_once = ONCE_FLAG_INIT;
+
+constexpr static char const utf8_isa_name[][8] = {
+	//! @cond
+	#define F(n,m,s) [n] = s,
+	//! @endcond
+	UTF8_ISA_DESCRIPTOR(F)
+	//! @cond
+	#undef F
+	//! @endcond
+};
+
+/**
+ * @brief Select @ref utf8_isa_sel.
+ */
+static void
+utf8_cpu_init (void)
+{
+#ifdef UTF8_SIMD
+	__builtin_cpu_init();
+
+	enum utf8_isa max = utf8_isa_scalar;
+	if (__builtin_cpu_supports("avx512bw") &&
+	    __builtin_cpu_supports("avx512vbmi"))
+		max = utf8_isa_avx512;
+	else if (__builtin_cpu_supports("avx2"))
+		max = utf8_isa_avx2;
+	else if (__builtin_cpu_supports("sse4.2"))
+		max = utf8_isa_sse42;
+
+	utf8_isa_sel = max;
+
+	char const *env = getenv("UTF8_KERNEL");
+	if (env) {
+		for (size_t i = 0; i <= max; ++i) {
+			if (!strcmp(env, utf8_isa_name[i])) {
+				utf8_isa_sel = (enum utf8_isa)i;
+				break;
+			}
+		}
+	}
+#endif /* UTF8_SIMD */
+}
+
+enum utf8_isa
+utf8_cpu_isa (void)
+{
+	call_once(&utf8_isa_once, utf8_cpu_init);
+	return utf8_isa_sel;
+}
+
+utf8_nonnull_out
+char const *
+utf8_kernel (void)
+{
+	return utf8_isa_name[utf8_cpu_isa()];
+}
+
+#endif /* !__cplusplus */
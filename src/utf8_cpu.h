@@ -0,0 +1,49 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_cpu.h
+ * @brief Runtime instruction set selection for the vector kernels.
+ * @author Juuso Alasuutari
+ */
+#ifndef CUTF8_SRC_UTF8_CPU_H_
+#define CUTF8_SRC_UTF8_CPU_H_
+
+#include "utf8_impl.h"
+
+/** @brief Instruction set levels that have kernel variants, from
+ *         the lowest to the highest.
+ *
+ * The columns are the enumeration, the label, and the name used
+ * for the level in the `UTF8_KERNEL` environment variable.
+ */
+#define UTF8_ISA_DESCRIPTOR(F)   \
+        F(0, scalar, "scalar")   \
+        F(1, sse42,  "sse4.2")   \
+        F(2, avx2,   "avx2")     \
+        F(3, avx512, "avx512")
+
+/**
+ * @brief Instruction set level enumeration.
+ */
+utf8_fixed_enum(utf8_isa, uint8_t) {
+	/** @cond */
+	#define XISA(n,m,...) utf8_isa_##m = n,
+	/** @endcond */
+	UTF8_ISA_DESCRIPTOR(XISA)
+	/** @cond */
+	#undef XISA
+	/** @endcond */
+};
+
+/**
+ * @brief Get the instruction set level the kernels should use.
+ *
+ * Determined once, on first call, as the highest level that both
+ * the CPU and the operating system support. If the `UTF8_KERNEL`
+ * environment variable names a level at or below that, the named
+ * level is used instead, which is handy for A/B testing.
+ *
+ * @return The instruction set level.
+ */
+extern enum utf8_isa
+utf8_cpu_isa (void);
+
+#endif /* CUTF8_SRC_UTF8_CPU_H_ */
@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_find.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#include <string.h>
+#include <threads.h>
+
+#include "utf8_cpu.h"
+#include "utf8_lut.h"
+
+/**
+ * @brief Search kernel: find the first match of a needle of `k >= 2`
+ *        bytes in `len` bytes at `ptr`, or return `nullptr`.
+ *
+ * The candidate test of every kernel is the same: the first and the
+ * last byte of the needle filter the haystack, and the bytes between
+ * are compared only where both match.
+ */
+typedef uint8_t const *(*utf8_find_fn)(uint8_t const *, size_t,
+                                       uint8_t const *, size_t);
+
+/**
+ * @brief Compare the bytes of a candidate match between the first
+ *        and the last one, which have matched already.
+ */
+utf8_nonnull_in
+utf8_force_inline bool
+utf8_find_mid (uint8_t const *const hay,
+               uint8_t const *const needle,
+               size_t               k)
+{
+	return k < 3U || !memcmp(hay + 1, needle + 1, k - 2U);
+}
+
+/**
+ * @brief Finish a search one candidate at a time with `memchr()` on
+ *        the first byte of the needle.
+ */
+static uint8_t const *
+utf8_find_scalar (uint8_t const *ptr,
+                  size_t         len,
+                  uint8_t const *needle,
+                  size_t         k)
+{
+	// The vector kernels may leave a tail shorter than the needle
+	if (len < k)
+		return nullptr;
+
+	uint8_t const *const last = ptr + len - k;
+
+	while (ptr <= last) {
+		ptr = memchr(ptr, needle[0], (size_t)(last - ptr) + 1U);
+		if (!ptr)
+			break;
+		if (ptr[k - 1U] == needle[k - 1U]
+		    && utf8_find_mid(ptr, needle, k))
+			return ptr;
+		++ptr;
+	}
+
+	return nullptr;
+}
+
+#ifdef UTF8_SIMD
+utf8_target_push("sse4.2")
+static uint8_t const *
+utf8_find_sse42 (uint8_t const *ptr,
+                 size_t         len,
+                 uint8_t const *needle,
+                 size_t         k)
+{
+	__m128i const first = _mm_set1_epi8((char)needle[0]);
+	__m128i const last = _mm_set1_epi8((char)needle[k - 1U]);
+	uint8_t const *const end = ptr + len;
+	uint8_t const *p = ptr;
+
+	for (; (size_t)(end - p) >= 16U + k - 1U; p += 16) {
+		__m128i a = _mm_loadu_si128((__m128i const *)p);
+		__m128i b = _mm_loadu_si128((__m128i const *)(p + k - 1U));
+		unsigned m = (unsigned)_mm_movemask_epi8(
+			_mm_and_si128(_mm_cmpeq_epi8(a, first),
+			              _mm_cmpeq_epi8(b, last)));
+		for (; m; m &= m - 1U) {
+			uint8_t const *q = p + __builtin_ctz(m);
+			if (utf8_find_mid(q, needle, k))
+				return q;
+		}
+	}
+
+	return utf8_find_scalar(p, (size_t)(end - p), needle, k);
+}
+utf8_target_pop()
+
+utf8_target_push("avx2")
+static uint8_t const *
+utf8_find_avx2 (uint8_t const *ptr,
+                size_t         len,
+                uint8_t const *needle,
+                size_t         k)
+{
+	__m256i const first = _mm256_set1_epi8((char)needle[0]);
+	__m256i const last = _mm256_set1_epi8((char)needle[k - 1U]);
+	uint8_t const *const end = ptr + len;
+	uint8_t const *p = ptr;
+
+	for (; (size_t)(end - p) >= 32U + k - 1U; p += 32) {
+		__m256i a = _mm256_loadu_si256((__m256i const *)p);
+		__m256i b = _mm256_loadu_si256((__m256i const *)(p + k - 1U));
+		unsigned m = (unsigned)_mm256_movemask_epi8(
+			_mm256_and_si256(_mm256_cmpeq_epi8(a, first),
+			                 _mm256_cmpeq_epi8(b, last)));
+		for (; m; m &= m - 1U) {
+			uint8_t const *q = p + __builtin_ctz(m);
+			if (utf8_find_mid(q, needle, k))
+				return q;
+		}
+	}
+
+	return utf8_find_sse42(p, (size_t)(end - p), needle, k);
+}
+utf8_target_pop()
+
+/**
+ * @brief Search kernels by instruction set level.
+ */
+static utf8_find_fn const utf8_find_kernel[] = {
+	[utf8_isa_scalar] = utf8_find_scalar,
+	[utf8_isa_sse42 ] = utf8_find_sse42,
+	[utf8_isa_avx2  ] = utf8_find_avx2,
+	[utf8_isa_avx512] = utf8_find_avx2,
+};
+
+/** The search kernel for multi-byte needles. */
+static utf8_find_fn utf8_find_sel = utf8_find_scalar;
+
+static once_flag utf8_find_once = ONCE_FLAG_INIT;
+
+/**
+ * @brief Select @ref utf8_find_sel.
+ */
+static void
+utf8_find_init (void)
+{
+	utf8_find_sel = utf8_find_kernel[utf8_cpu_isa()];
+}
+#endif /* UTF8_SIMD */
+
+utf8_nonnull_in
+uint8_t const *
+utf8_find (uint8_t const *const ptr,
+           size_t               len,
+           uint8_t const *const needle,
+           size_t               needle_len)
+{
+	if (!needle_len)
+		return ptr;
+
+	// A match begins where the needle does, which is never in the
+	// continuation byte class 0x80-0xbf if the needle is valid, so
+	// every match is on a code point boundary of the haystack
+	if (needle_len > len || (utf8_lut[needle[0]] & utf8_bit(cb1))
+	    || !utf8_validate(needle, needle_len))
+		return nullptr;
+
+	if (needle_len == 1U)
+		return memchr(ptr, needle[0], len);
+
+#ifdef UTF8_SIMD
+	call_once(&utf8_find_once, utf8_find_init);
+	return utf8_find_sel(ptr, len, needle, needle_len);
+#else /* UTF8_SIMD */
+	return utf8_find_scalar(ptr, len, needle, needle_len);
+#endif /* UTF8_SIMD */
+}
+
+utf8_nonnull_in
+uint8_t const *
+utf8_find_code_point (uint8_t const *const ptr,
+                      size_t               len,
+                      uint32_t             cp)
+{
+	uint8_t buf[4];
+	struct utf8_conv c = utf32_to_utf8(buf, &cp, 1U, utf8_stop);
+	return c.error ? nullptr : utf8_find(ptr, len, buf, c.out);
+}
+
+#endif /* !__cplusplus */
@@ -12,6 +12,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -48,10 +49,54 @@ string_copy (char                 *dst,
 	return ret - 1;
 }
 
-char *
-utf8_graph (char              *dst,
-            char const *const  end,
-            int        *const  err)
+#ifdef UTF8_PROFILE
+__attribute__((format(printf, 4, 5)))
+static char *
+string_print (char              *dst,
+              char const *const  end,
+              int        *const  err,
+              char const        *fmt,
+              ...)
+{
+	if (!dst)
+		return nullptr;
+
+	va_list ap;
+	va_start(ap, fmt);
+	size_t sz = (size_t)(end - dst);
+	int n = vsnprintf(dst, sz, fmt, ap);
+	va_end(ap);
+
+	if (n < 0) {
+		*err = EIO;
+		return nullptr;
+	}
+	if ((size_t)n >= sz) {
+		*err = E2BIG;
+		return nullptr;
+	}
+
+	return dst + n;
+}
+
+/**
+ * @brief Get a DOT edge pen width for a transition count.
+ *
+ * Grows with the bit width of the count, from 1 for a count
+ * of 1 to 9 for counts of 2^56 and up.
+ */
+utf8_const_inline unsigned
+pen_width (uint64_t count)
+{
+	return 1U + (64U - (unsigned)__builtin_clzll(count | 1U)) / 8U;
+}
+#endif /* UTF8_PROFILE */
+
+static char *
+graph (char                      *dst,
+       char const *const          end,
+       struct utf8_profile const *prof,
+       int        *const          err)
 {
 	constexpr const uint8_t utf8_range[][4] = {
 		//! @cond
@@ -154,6 +199,23 @@ utf8_graph (char              *dst,
 			if (!(bits & 1U))
 				continue;
 
+#ifdef UTF8_PROFILE
+			if (prof) {
+				uint64_t w = prof->transitions[src_idx][dst_idx];
+				dst = w ? string_print(dst, end, err,
+				                       "\tx%02zx -> x%02x [label=\"%"
+				                       PRIu64 "\", penwidth=%u];\n",
+				                       src_idx, dst_idx, w,
+				                       pen_width(w))
+				        : string_print(dst, end, err,
+				                       "\tx%02zx -> x%02x [style=dotted];\n",
+				                       src_idx, dst_idx);
+				if (!dst)
+					return nullptr;
+				continue;
+			}
+#endif /* UTF8_PROFILE */
+
 			size_t sz = (size_t)(end - dst);
 			int n = snprintf(dst, sz, "\tx%02zx -> x%02x;\n",
 			                 src_idx, dst_idx);
@@ -169,7 +231,61 @@ utf8_graph (char              *dst,
 		}
 	}
 
+#ifdef UTF8_PROFILE
+	if (prof) {
+		bool bad = false;
+		for (size_t i = 0; i < array_size(prof->errors); ++i) {
+			uint64_t w = prof->errors[i];
+			if (!w)
+				continue;
+			if (!bad) {
+				bad = true;
+				dst = string_copy(dst, end, "\terr [shape=box, "
+				                  "color=red, label=\"error\"];\n",
+				                  err);
+			}
+			dst = string_print(dst, end, err, "\tx%02zx -> err [label="
+			                   "\"%" PRIu64 "\", penwidth=%u, color=red];\n",
+			                   i, w, pen_width(w));
+		}
+
+		dst = string_print(dst, end, err, "\tlabel=\"bytes by sequence"
+		                   " length: 1: %" PRIu64 ", 2: %" PRIu64 ", 3: %"
+		                   PRIu64 ", 4: %" PRIu64 "\";\n", prof->bytes[0],
+		                   prof->bytes[1], prof->bytes[2], prof->bytes[3]);
+		if (!dst)
+			return nullptr;
+	}
+#else /* UTF8_PROFILE */
+	(void)prof;
+#endif /* UTF8_PROFILE */
+
 	return string_copy(dst, end, "}\n", err);
 }
 
+char *
+utf8_graph (char              *dst,
+            char const *const  end,
+            int        *const  err)
+{
+	return graph(dst, end, nullptr, err);
+}
+
+#ifdef UTF8_PROFILE
+char *
+utf8_graph_profile (char                      *dst,
+                    char const *const          end,
+                    struct utf8_profile const *prof,
+                    int        *const          err)
+{
+	if (!prof) {
+		if (err)
+			*err = EFAULT;
+		return nullptr;
+	}
+
+	return graph(dst, end, prof, err);
+}
+#endif /* UTF8_PROFILE */
+
 #endif /* !__cplusplus */
@@ -6,9 +6,35 @@
 #ifndef CUTF8_SRC_UTF8_GRAPH_H_
 #define CUTF8_SRC_UTF8_GRAPH_H_
 
+struct utf8_profile;
+
 extern char *
 utf8_graph (char       *dst,
             char const *end,
             int        *err);
 
+#ifdef UTF8_PROFILE
+/**
+ * @brief Render the state machine graph like @ref utf8_graph(), with
+ *        the edges weighted by profiling counters.
+ *
+ * Each transition is labelled with its count and drawn thicker the
+ * larger the count is; transitions never taken are dotted. States
+ * which rejected input have an edge to an extra error node, and the
+ * byte counts by sequence length go in the graph label.
+ *
+ * @param dst  Output buffer.
+ * @param end  End of the output buffer.
+ * @param prof Counters, as from @ref utf8_profile_get().
+ * @param err  Where to store an error code on failure.
+ * @return The terminating null byte written to `dst`, or `nullptr`
+ *         on failure.
+ */
+extern char *
+utf8_graph_profile (char                      *dst,
+                    char const                *end,
+                    struct utf8_profile const *prof,
+                    int                       *err);
+#endif /* UTF8_PROFILE */
+
 #endif /* CUTF8_SRC_UTF8_GRAPH_H_ */
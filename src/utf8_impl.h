@@ -6,9 +6,22 @@
 #ifndef CUTF8_SRC_UTF8_IMPL_H_
 #define CUTF8_SRC_UTF8_IMPL_H_
 
-#ifdef DEBUG
-# include <stdio.h>
-#endif /* DEBUG */
+/* Building with UTF8_NO_SIMD defined leaves out every vector
+ * instruction set code path and uses only the scalar ones.
+ */
+#if defined __SSE2__ && !defined UTF8_NO_SIMD
+# include <emmintrin.h>
+#endif /* __SSE2__ && !UTF8_NO_SIMD */
+
+/* Vector kernels for instruction sets beyond the build target's
+ * baseline are compiled with per-function target options and are
+ * selected at runtime, see utf8_cpu.h.
+ */
+#if (defined __x86_64__ || defined __i386__) && defined __GNUC__ \
+ && !defined UTF8_NO_SIMD
+# define UTF8_SIMD
+# include <immintrin.h>
+#endif
 
 #include "utf8_priv.h"
 
@@ -54,6 +67,23 @@
 
 //! @endcond
 
+#ifdef UTF8_SIMD
+/** @brief Compile the functions that follow for instruction set `isa`,
+ *         a string literal in the GCC `target` attribute syntax.
+ */
+# define utf8_target_push(isa)                               \
+        utf8_pragma_gcc(push_options)                        \
+        utf8_pragma_gcc(target(isa))                         \
+        utf8_pragma_clang(attribute push(                    \
+          __attribute__((target(isa))), apply_to = function))
+
+/** @brief End a @ref utf8_target_push() region.
+ */
+# define utf8_target_pop()                                   \
+        utf8_pragma_gcc(pop_options)                         \
+        utf8_pragma_clang(attribute pop)
+#endif /* UTF8_SIMD */
+
 /** @brief Calculate the element count of an array.
  */
 #define array_size(x) (sizeof(x) / sizeof((x)[0]))
@@ -86,10 +116,52 @@
         unsigned short:1, unsigned:1, \
         typeof(1UL):1,typeof(1ULL):1) < (typeof(x))0)
 
-#ifdef DEBUG
-# define pr_(fmt, ...) (void)fprintf(stderr, fmt "\n", __VA_ARGS__)
-#else /* DEBUG */
-# define pr_(...)
-#endif /* DEBUG */
+/**
+ * @brief Get the length of the run of ASCII bytes at the start of
+ *        a buffer.
+ *
+ * Tests 16 bytes at a time with SSE2 where available, otherwise 8
+ * bytes at a time in a 64-bit word, looking only at the high bits.
+ *
+ * @param ptr Start of the buffer.
+ * @param end End of the buffer.
+ * @return The number of bytes before the first non-ASCII byte or
+ *         `end`, whichever comes first.
+ */
+utf8_nonnull_in
+utf8_force_inline size_t
+utf8_ascii_run (uint8_t const *const ptr,
+                uint8_t const *const end)
+{
+	uint8_t const *p = ptr;
+
+#if defined __SSE2__ && !defined UTF8_NO_SIMD
+	for (; end - p >= 16; p += 16) {
+		unsigned m = (unsigned)_mm_movemask_epi8(
+			_mm_loadu_si128((__m128i const *)p));
+		if (m)
+			return (size_t)(p - ptr) + (unsigned)__builtin_ctz(m);
+	}
+#endif /* __SSE2__ && !UTF8_NO_SIMD */
+
+	for (; end - p >= 8; p += 8) {
+		uint64_t w;
+		__builtin_memcpy(&w, p, sizeof w);
+		w &= UINT64_C(0x8080808080808080);
+		if (w) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			unsigned n = (unsigned)__builtin_clzll(w);
+#else
+			unsigned n = (unsigned)__builtin_ctzll(w);
+#endif
+			return (size_t)(p - ptr) + (n >> 3U);
+		}
+	}
+
+	while (p < end && *p < 0x80U)
+		++p;
+
+	return (size_t)(p - ptr);
+}
 
 #endif /* CUTF8_SRC_UTF8_IMPL_H_ */
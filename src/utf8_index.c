@@ -0,0 +1,235 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_index.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utf8_impl.h"
+
+/** Bytes per leading byte mask. */
+constexpr static const size_t utf8_index_chunk = 64U;
+
+/**
+ * @brief Find the leading bytes, which are the bytes that are not
+ *        continuation bytes, in 64 bytes of input.
+ *
+ * @return A mask with bit `i` set if `ptr[i]` is a leading byte.
+ */
+utf8_nonnull_in
+utf8_force_inline uint64_t
+utf8_index_mask (uint8_t const *const ptr)
+{
+	uint64_t m = 0;
+
+#if defined __SSE2__ && !defined UTF8_NO_SIMD
+	__m128i const cb = _mm_set1_epi8((char)0xbf);
+
+	for (unsigned i = 0; i < 4U; ++i) {
+		__m128i v = _mm_loadu_si128((__m128i const *)ptr + i);
+		m |= (uint64_t)(unsigned)_mm_movemask_epi8(
+			_mm_cmpgt_epi8(v, cb)) << (i * 16U);
+	}
+#else /* __SSE2__ && !UTF8_NO_SIMD */
+	for (unsigned i = 0; i < 64U; ++i)
+		m |= (uint64_t)((int8_t)ptr[i] >= -0x40) << i;
+#endif /* __SSE2__ && !UTF8_NO_SIMD */
+
+	return m;
+}
+
+/**
+ * @brief Find the leading bytes in fewer than 64 bytes of input.
+ *
+ * The missing bytes are taken to be continuation bytes.
+ */
+utf8_nonnull_in
+utf8_force_inline uint64_t
+utf8_index_mask_tail (uint8_t const *const ptr,
+                      size_t               len)
+{
+	uint8_t buf[64];
+	memset(buf, 0x80, sizeof buf);
+	memcpy(buf, ptr, len);
+	return utf8_index_mask(buf);
+}
+
+/**
+ * @brief Get the position of the `k`th lowest set bit of a mask,
+ *        counting from 0, which must exist.
+ */
+utf8_const_inline unsigned
+utf8_index_select (uint64_t m,
+                   size_t   k)
+{
+	for (; k; --k)
+		m &= m - 1U;
+	return (unsigned)__builtin_ctzll(m);
+}
+
+/**
+ * @brief Get the offset of the `k`th leading byte from `ptr` on,
+ *        counting from 0, which must exist.
+ */
+utf8_nonnull_in
+static size_t
+utf8_index_seek (uint8_t const *const ptr,
+                 uint8_t const *const end,
+                 size_t               k)
+{
+	size_t i = 0;
+
+	for (;; i += utf8_index_chunk) {
+		size_t n = (size_t)(end - ptr) - i;
+		uint64_t m = n >= utf8_index_chunk
+		           ? utf8_index_mask(ptr + i)
+		           : utf8_index_mask_tail(ptr + i, n);
+		size_t c = (size_t)__builtin_popcountll(m);
+		if (k < c)
+			return i + utf8_index_select(m, k);
+		k -= c;
+	}
+}
+
+/**
+ * @brief Count the leading bytes in `[ptr, end)`.
+ */
+utf8_nonnull_in
+static size_t
+utf8_index_count (uint8_t const *ptr,
+                  uint8_t const *end)
+{
+	size_t n = 0;
+
+	for (; (size_t)(end - ptr) >= utf8_index_chunk;
+	     ptr += utf8_index_chunk)
+		n += (size_t)__builtin_popcountll(utf8_index_mask(ptr));
+
+	if (ptr < end)
+		n += (size_t)__builtin_popcountll(
+			utf8_index_mask_tail(ptr, (size_t)(end - ptr)));
+
+	return n;
+}
+
+utf8_nonnull_in
+int
+utf8_index_build (struct utf8_index *const idx,
+                  uint8_t const     *const ptr,
+                  size_t                   len,
+                  size_t                   stride)
+{
+	if (!stride)
+		return EINVAL;
+
+	// A stride longer than the input records only the first code
+	// point, like one just longer than it does, which keeps the
+	// steps below from overflowing
+	size_t const step = stride > len ? len + 1U : stride;
+
+	// Every code point has a leading byte, so this is enough for
+	// any input. The excess is given back once the count is known.
+	size_t cap = len / step + 1U;
+	size_t *off = calloc(cap, sizeof *off);
+	if (!off)
+		return ENOMEM;
+
+	size_t count = 0; // Leading bytes before the current chunk
+	size_t next = 0;  // The number of the next code point to record
+	size_t n = 0;
+
+	for (size_t i = 0; i < len; i += utf8_index_chunk) {
+		uint64_t m = len - i >= utf8_index_chunk
+		           ? utf8_index_mask(ptr + i)
+		           : utf8_index_mask_tail(ptr + i, len - i);
+		size_t c = (size_t)__builtin_popcountll(m);
+
+		// Clear the mask up to each recorded code point in turn,
+		// which takes one step per code point at most
+		for (size_t k = count; next < count + c; next += step) {
+			for (; k < next; ++k)
+				m &= m - 1U;
+			off[n++] = i + (unsigned)__builtin_ctzll(m);
+		}
+
+		count += c;
+	}
+
+	if (n && n < cap) {
+		size_t *p = realloc(off, n * sizeof *off);
+		if (p)
+			off = p;
+	}
+
+	*idx = (struct utf8_index){
+		.ptr     = ptr,
+		.len     = len,
+		.count   = count,
+		.stride  = stride,
+		.offsets = off,
+	};
+
+	return 0;
+}
+
+utf8_nonnull_in
+void
+utf8_index_free (struct utf8_index *const idx)
+{
+	free(idx->offsets);
+	idx->offsets = nullptr;
+	idx->count = 0;
+}
+
+utf8_nonnull_in
+size_t
+utf8_index_byte_offset (struct utf8_index const *const idx,
+                        size_t                         n)
+{
+	if (n >= idx->count)
+		return idx->len;
+
+	size_t o = idx->offsets[n / idx->stride];
+	size_t k = n % idx->stride;
+	if (!k)
+		return o;
+
+	// Code point n is the kth leading byte after the recorded one
+	return o + 1U + utf8_index_seek(idx->ptr + o + 1U,
+	                                idx->ptr + idx->len, k - 1U);
+}
+
+utf8_nonnull_in
+size_t
+utf8_index_char_offset (struct utf8_index const *const idx,
+                        size_t                         offset)
+{
+	if (offset >= idx->len)
+		return idx->count;
+
+	// Find the last recorded code point at or before the offset
+	size_t lo = 0;
+	size_t hi = idx->count / idx->stride
+	          + (idx->count % idx->stride != 0);
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2U;
+		if (idx->offsets[mid] <= offset)
+			lo = mid + 1U;
+		else
+			hi = mid;
+	}
+
+	// Only continuation bytes precede the first code point
+	if (!lo--)
+		return 0;
+
+	size_t o = idx->offsets[lo];
+	return lo * idx->stride + utf8_index_count(idx->ptr + o + 1U,
+	                                           idx->ptr + offset + 1U);
+}
+
+#endif /* !__cplusplus */
@@ -0,0 +1,85 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_lut.h
+ * @brief Parser state transition tables shared by the scalar
+ *        state machine and the bulk processing kernels.
+ * @author Juuso Alasuutari
+ */
+#ifndef CUTF8_SRC_UTF8_LUT_H_
+#define CUTF8_SRC_UTF8_LUT_H_
+
+#include "utf8_impl.h"
+
+//! @cond
+
+#define X1(x)   x
+#define X2(x)   x,x
+#define X3(x)   x,x,x
+#define X8(x)   x,x,x,x,x,x,x,x
+#define X11(x)  X8(x),x,x,x
+#define X12(x)  X11(x),x
+#define X16(x)  X8(x),X8(x)
+#define X30(x)  X16(x),X12(x),x,x
+#define X32(x)  X16(x),X16(x)
+#define X128(x) X32(x),X32(x),X32(x),X32(x)
+#define X(n, x) X##n(x)
+
+//! @endcond
+
+/** @brief Lookup table
+ * @showinitializer
+ */
+constexpr static const uint16_t utf8_lut[] = {
+	X(128,utf8_bit(asc)  ), /* 0x00-0x7f */
+
+	/* 0x80-0x8f */
+	X(16,utf8_bit(cb3)   \
+	    |utf8_bit(cb3_f4)\
+	    |utf8_bit(cb2)   \
+	    |utf8_bit(cb2_ed)\
+	    |utf8_bit(cb1)   ),
+
+	/* 0x90-0x9f */
+	X(16,utf8_bit(cb3)   \
+	    |utf8_bit(cb3_f0)\
+	    |utf8_bit(cb2)   \
+	    |utf8_bit(cb2_ed)\
+	    |utf8_bit(cb1)   ),
+
+	/* 0xa0-0xbf */
+	X(32,utf8_bit(cb3)   \
+	    |utf8_bit(cb3_f0)\
+	    |utf8_bit(cb2)   \
+	    |utf8_bit(cb2_e0)\
+	    |utf8_bit(cb1)   ),
+
+	X( 2,0               ), /* 0xc0-0xc1 */
+	X(30,utf8_bit(lb2)   ), /* 0xc2-0xdf */
+	X( 1,utf8_bit(lb3_e0)), /* 0xe0      */
+	X(12,utf8_bit(lb3)   ), /* 0xe1-0xec */
+	X( 1,utf8_bit(lb3_ed)), /* 0xed      */
+	X( 2,utf8_bit(lb3)   ), /* 0xee-0xef */
+	X( 1,utf8_bit(lb4_f0)), /* 0xf0      */
+	X( 3,utf8_bit(lb4)   ), /* 0xf1-0xf3 */
+	X( 1,utf8_bit(lb4_f4)), /* 0xf4      */
+	X(11,0               ), /* 0xf5-0xff */
+};
+
+//! @cond
+
+#undef X
+#undef X128
+#undef X32
+#undef X30
+#undef X16
+#undef X12
+#undef X11
+#undef X8
+#undef X3
+#undef X2
+#undef X1
+
+//! @endcond
+
+constexpr static const UTF8_PARSER_STATE_MAP(utf8_dst);
+
+#endif /* CUTF8_SRC_UTF8_LUT_H_ */
@@ -0,0 +1,142 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_nfc.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#include <errno.h>
+
+#include "utf8_nfc_lut.h"
+
+/** Input validated at a time, small enough to still be in L1 cache
+ *  when it is scanned for the quick check. */
+constexpr static const size_t utf8_nfc_block = (size_t)1U << 12U;
+
+/**
+ * @brief Look up the NFC quick check entry of a code point.
+ *
+ * @param cp A Unicode scalar value.
+ * @return The NFC_QC value in bits 6-7 and the rank of the canonical
+ *         combining class in bits 0-5, see `utf8_nfc_lut.h`.
+ */
+utf8_const_inline unsigned
+utf8_nfc_entry (uint32_t cp)
+{
+	if (cp >= utf8_nfc_end)
+		return 0;
+
+	return utf8_nfc_blk[utf8_nfc_idx[cp >> utf8_nfc_blk_bits]]
+	                   [cp & ((1U << utf8_nfc_blk_bits) - 1U)];
+}
+
+/**
+ * @brief Measure a run of bytes below 0xcc, which can't begin a code
+ *        point at or above U+0300.
+ *
+ * Code points below U+0300 are NFC_QC=Yes and of combining class 0,
+ * so the run needs no table lookups. It starts and ends on a code
+ * point boundary if `ptr` is on one, because 0xcc is above all of the
+ * continuation bytes.
+ *
+ * @return The number of bytes before the first byte 0xcc-0xff or
+ *         before `end`.
+ */
+utf8_nonnull_in
+utf8_force_inline size_t
+utf8_nfc_run (uint8_t const *const ptr,
+              uint8_t const *const end)
+{
+	uint8_t const *p = ptr;
+
+#if defined __SSE2__ && !defined UTF8_NO_SIMD
+	// Flipping the top bit makes the signed compare an unsigned one
+	__m128i const top = _mm_set1_epi8((char)0x80);
+	__m128i const max = _mm_set1_epi8((char)(0xcbU ^ 0x80U));
+
+	for (; end - p >= 16; p += 16) {
+		__m128i v = _mm_loadu_si128((__m128i const *)p);
+		unsigned m = (unsigned)_mm_movemask_epi8(
+			_mm_cmpgt_epi8(_mm_xor_si128(v, top), max));
+		if (m)
+			return (size_t)(p - ptr) + (unsigned)__builtin_ctz(m);
+	}
+#endif /* __SSE2__ && !UTF8_NO_SIMD */
+
+	while (p < end && *p < 0xccU)
+		++p;
+
+	return (size_t)(p - ptr);
+}
+
+utf8_nonnull_in
+struct utf8_nfc
+utf8_nfc_quick_check (uint8_t const *const ptr,
+                      size_t               len)
+{
+	struct utf8_nfc ret = {
+		.offset = len,
+		.result = utf8_nfc_yes,
+		.error  = 0,
+	};
+	uint8_t const *p = ptr;
+	uint8_t const *const end = ptr + len;
+	unsigned last = 0;
+
+	while (p < end) {
+		// Validate a block at a time, cut before a leading byte
+		// so that no sequence straddles two blocks
+		uint8_t const *q = end;
+		if ((size_t)(end - p) > utf8_nfc_block) {
+			q = p + utf8_nfc_block;
+			for (int i = 0; i < 3 && (*q & 0xc0U) == 0x80U; ++i)
+				--q;
+		}
+
+		struct utf8_check c = utf8_check(p, (size_t)(q - p));
+		uint8_t const *const valid = p + c.offset;
+
+		// After a No only the validation is left to do
+		while (ret.result != utf8_nfc_no && p < valid) {
+			size_t n = utf8_nfc_run(p, valid);
+			if (n) {
+				p += n;
+				last = 0;
+				if (p == valid)
+					break;
+			}
+
+			struct utf8_decoded d = utf8_decode_next(p, valid);
+			unsigned e = utf8_nfc_entry(d.code_point);
+			unsigned cls = e & 0x3fU;
+			enum utf8_nfc_qc qc = (enum utf8_nfc_qc)(e >> 6U);
+
+			// Combining marks out of canonical order
+			if (cls && cls < last)
+				qc = utf8_nfc_no;
+
+			if (qc != utf8_nfc_yes) {
+				if (ret.result == utf8_nfc_yes)
+					ret.offset = (size_t)(p - ptr);
+				ret.result = qc;
+			}
+
+			last = cls;
+			p += d.len;
+		}
+
+		if (c.error != utf8_valid) {
+			if (ret.result == utf8_nfc_yes)
+				ret.offset = (size_t)(p - ptr);
+			ret.result = utf8_nfc_no;
+			ret.error = EILSEQ;
+			break;
+		}
+
+		p = q;
+	}
+
+	return ret;
+}
+
+#endif /* !__cplusplus */
@@ -0,0 +1,1094 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_validate.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#ifdef _WIN32
+# define _CRT_SECURE_NO_WARNINGS
+# define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+#ifndef _WIN32
+# include <unistd.h>
+#endif
+
+#include "utf8_cpu.h"
+#include "utf8_lut.h"
+#include "utf8_vec.h"
+
+/**
+ * @brief Count the bytes in `[ptr, end)` which are not continuations.
+ */
+static size_t
+utf8_count_leading (uint8_t const *ptr,
+                    uint8_t const *end)
+{
+	size_t n = 0;
+	for (; ptr < end; ++ptr)
+		n += (int8_t)*ptr >= -0x40;
+	return n;
+}
+
+#ifdef UTF8_SIMD
+/** The vector kernel tables, filled in by utf8_vec_init(). */
+static struct utf8_vec_lut utf8_vec;
+
+/** The selected code point counting kernel, or `nullptr`. */
+static size_t (*utf8_vec_count)(uint8_t const *, size_t);
+
+static once_flag utf8_vec_once = ONCE_FLAG_INIT;
+
+/**
+ * @brief Shift the last (up to) three bytes of a buffer into
+ *        a vector kernel carry value.
+ */
+utf8_force_inline uint32_t
+utf8_vec_carry (uint32_t             carry,
+                uint8_t const *const ptr,
+                size_t               len)
+{
+	for (size_t i = len > 3U ? len - 3U : 0; i < len; ++i)
+		carry = (carry >> 8U) | (uint32_t)ptr[i] << 16U;
+	return carry;
+}
+
+utf8_target_push("sse4.2")
+
+/**
+ * @brief Look up 0xc0-0xff in a 64-entry table, 0 for other bytes.
+ */
+utf8_force_inline __m128i
+utf8_vec_lead_sse42 (__m128i const  x,
+                     __m128i const *t)
+{
+	__m128i r = _mm_setzero_si128();
+	for (int i = 0; i < 4; ++i) {
+		__m128i k = _mm_sub_epi8(x, _mm_set1_epi8((char)(0xc0 + (i << 4))));
+		k = _mm_adds_epu8(k, _mm_set1_epi8(0x70));
+		r = _mm_or_si128(r, _mm_shuffle_epi8(t[i], k));
+	}
+	return r;
+}
+
+/**
+ * @brief Validate one 16-byte block, given the block before it.
+ *
+ * @return A vector with non-zero lanes where errors were found.
+ */
+utf8_force_inline __m128i
+utf8_vec_check_sse42 (__m128i const  cur,
+                      __m128i const  prev,
+                      __m128i const *lead,
+                      __m128i const  cont,
+                      __m128i const *need)
+{
+	__m128i p1 = _mm_alignr_epi8(cur, prev, 15);
+	__m128i p2 = _mm_alignr_epi8(cur, prev, 14);
+	__m128i p3 = _mm_alignr_epi8(cur, prev, 13);
+
+	__m128i hi = _mm_and_si128(_mm_srli_epi16(cur, 4),
+	                           _mm_set1_epi8(0x0f));
+	__m128i e = _mm_and_si128(utf8_vec_lead_sse42(p1, lead),
+	                          _mm_shuffle_epi8(cont, hi));
+
+	__m128i must = _mm_or_si128(_mm_subs_epu8(p1, need[0]),
+	               _mm_or_si128(_mm_subs_epu8(p2, need[1]),
+	                            _mm_subs_epu8(p3, need[2])));
+	must = _mm_cmpgt_epi8(must, _mm_setzero_si128());
+
+	__m128i is_cont = _mm_cmpgt_epi8(_mm_set1_epi8(-64), cur);
+
+	return _mm_or_si128(e, _mm_xor_si128(must, is_cont));
+}
+
+static bool
+utf8_validate_sse42 (struct utf8_vec_lut const *const v,
+                     uint8_t const                   *ptr,
+                     size_t                           len,
+                     uint32_t                  *const carry,
+                     size_t                    *const count)
+{
+	__m128i const lead[4] = {
+		_mm_loadu_si128((__m128i const *)&v->lead[0x00]),
+		_mm_loadu_si128((__m128i const *)&v->lead[0x10]),
+		_mm_loadu_si128((__m128i const *)&v->lead[0x20]),
+		_mm_loadu_si128((__m128i const *)&v->lead[0x30]),
+	};
+	__m128i const cont = _mm_loadu_si128((__m128i const *)v->cont);
+	__m128i const need[3] = {
+		_mm_set1_epi8((char)v->need[0]),
+		_mm_set1_epi8((char)v->need[1]),
+		_mm_set1_epi8((char)v->need[2]),
+	};
+	__m128i const tail = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+	                                   -1, -1, -1, -1, -1,
+	                                   (char)v->need[2],
+	                                   (char)v->need[1],
+	                                   (char)v->need[0]);
+
+	uint8_t const *const beg = ptr;
+	size_t const         num = len;
+	__m128i prev = _mm_slli_si128(_mm_cvtsi32_si128((int)*carry), 13);
+	__m128i err = _mm_setzero_si128();
+	size_t ncont = 0;
+
+	for (; len >= 16U; ptr += 16, len -= 16U) {
+		__m128i cur = _mm_loadu_si128((__m128i const *)ptr);
+		if (_mm_movemask_epi8(cur)) {
+			err = _mm_or_si128(err, utf8_vec_check_sse42(
+				cur, prev, lead, cont, need));
+			ncont += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(
+				_mm_cmpgt_epi8(_mm_set1_epi8(-64), cur)));
+		} else
+			err = _mm_or_si128(err, _mm_subs_epu8(prev, tail));
+		prev = cur;
+	}
+
+	if (len) {
+		uint8_t buf[16] = {0};
+		__builtin_memcpy(buf, ptr, len);
+		__m128i cur = _mm_loadu_si128((__m128i const *)buf);
+		__m128i msk = _mm_cmpgt_epi8(_mm_set1_epi8((char)len),
+		                             _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+		                                           8, 9, 10, 11, 12, 13, 14, 15));
+		err = _mm_or_si128(err, _mm_and_si128(msk, utf8_vec_check_sse42(
+			cur, prev, lead, cont, need)));
+		ncont += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(
+			_mm_cmpgt_epi8(_mm_set1_epi8(-64), cur)));
+	}
+
+	*carry = utf8_vec_carry(*carry, beg, num);
+	*count = num - ncont;
+	return _mm_testz_si128(err, err);
+}
+
+/**
+ * @brief Count the bytes which are not continuation bytes.
+ *
+ * Compare results are summed in byte lanes for up to 255 blocks at a
+ * time, then folded into 64-bit sums.
+ */
+static size_t
+utf8_count_sse42 (uint8_t const *ptr,
+                  size_t         len)
+{
+	__m128i const c = _mm_set1_epi8(-65);
+	size_t n = 0;
+
+	while (len >= 16U) {
+		__m128i acc = _mm_setzero_si128();
+		for (unsigned i = 0; i < 255U && len >= 16U; ++i) {
+			__m128i cur = _mm_loadu_si128((__m128i const *)ptr);
+			acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(cur, c));
+			ptr += 16;
+			len -= 16U;
+		}
+		// Stored rather than extracted, which is x86-64 only
+		uint64_t sum[2];
+		_mm_storeu_si128((__m128i *)sum,
+		                 _mm_sad_epu8(acc, _mm_setzero_si128()));
+		n += (size_t)(sum[0] + sum[1]);
+	}
+
+	return n + utf8_count_leading(ptr, ptr + len);
+}
+utf8_target_pop()
+
+utf8_target_push("avx2")
+
+/**
+ * @brief Look up 0xc0-0xff in a 64-entry table, 0 for other bytes.
+ */
+utf8_force_inline __m256i
+utf8_vec_lead_avx2 (__m256i const  x,
+                    __m256i const *t)
+{
+	__m256i r = _mm256_setzero_si256();
+	for (int i = 0; i < 4; ++i) {
+		__m256i k = _mm256_sub_epi8(x, _mm256_set1_epi8((char)(0xc0 + (i << 4))));
+		k = _mm256_adds_epu8(k, _mm256_set1_epi8(0x70));
+		r = _mm256_or_si256(r, _mm256_shuffle_epi8(t[i], k));
+	}
+	return r;
+}
+
+/**
+ * @brief Validate one 32-byte block, given the block before it.
+ *
+ * @return A vector with non-zero lanes where errors were found.
+ */
+utf8_force_inline __m256i
+utf8_vec_check_avx2 (__m256i const  cur,
+                     __m256i const  prev,
+                     __m256i const *lead,
+                     __m256i const  cont,
+                     __m256i const *need)
+{
+	__m256i p0 = _mm256_permute2x128_si256(prev, cur, 0x21);
+	__m256i p1 = _mm256_alignr_epi8(cur, p0, 15);
+	__m256i p2 = _mm256_alignr_epi8(cur, p0, 14);
+	__m256i p3 = _mm256_alignr_epi8(cur, p0, 13);
+
+	__m256i hi = _mm256_and_si256(_mm256_srli_epi16(cur, 4),
+	                              _mm256_set1_epi8(0x0f));
+	__m256i e = _mm256_and_si256(utf8_vec_lead_avx2(p1, lead),
+	                             _mm256_shuffle_epi8(cont, hi));
+
+	__m256i must = _mm256_or_si256(_mm256_subs_epu8(p1, need[0]),
+	               _mm256_or_si256(_mm256_subs_epu8(p2, need[1]),
+	                               _mm256_subs_epu8(p3, need[2])));
+	must = _mm256_cmpgt_epi8(must, _mm256_setzero_si256());
+
+	__m256i is_cont = _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), cur);
+
+	return _mm256_or_si256(e, _mm256_xor_si256(must, is_cont));
+}
+
+static bool
+utf8_validate_avx2 (struct utf8_vec_lut const *const v,
+                    uint8_t const                   *ptr,
+                    size_t                           len,
+                    uint32_t                  *const carry,
+                    size_t                    *const count)
+{
+	__m256i const lead[4] = {
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)&v->lead[0x00])),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)&v->lead[0x10])),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)&v->lead[0x20])),
+		_mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i const *)&v->lead[0x30])),
+	};
+	__m256i const cont = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((__m128i const *)v->cont));
+	__m256i const need[3] = {
+		_mm256_set1_epi8((char)v->need[0]),
+		_mm256_set1_epi8((char)v->need[1]),
+		_mm256_set1_epi8((char)v->need[2]),
+	};
+	__m256i const tail = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+	                                      -1, -1, -1, -1, -1, -1, -1, -1,
+	                                      -1, -1, -1, -1, -1, -1, -1, -1,
+	                                      -1, -1, -1, -1, -1,
+	                                      (char)v->need[2],
+	                                      (char)v->need[1],
+	                                      (char)v->need[0]);
+
+	uint8_t const *const beg = ptr;
+	size_t const         num = len;
+	__m256i prev = _mm256_inserti128_si256(_mm256_setzero_si256(),
+		_mm_slli_si128(_mm_cvtsi32_si128((int)*carry), 13), 1);
+	__m256i err = _mm256_setzero_si256();
+	size_t ncont = 0;
+
+	for (; len >= 32U; ptr += 32, len -= 32U) {
+		__m256i cur = _mm256_loadu_si256((__m256i const *)ptr);
+		if (_mm256_movemask_epi8(cur)) {
+			err = _mm256_or_si256(err, utf8_vec_check_avx2(
+				cur, prev, lead, cont, need));
+			ncont += (size_t)__builtin_popcount((unsigned)_mm256_movemask_epi8(
+				_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), cur)));
+		} else
+			err = _mm256_or_si256(err, _mm256_subs_epu8(prev, tail));
+		prev = cur;
+	}
+
+	if (len) {
+		uint8_t buf[32] = {0};
+		__builtin_memcpy(buf, ptr, len);
+		__m256i cur = _mm256_loadu_si256((__m256i const *)buf);
+		__m256i msk = _mm256_cmpgt_epi8(
+			_mm256_set1_epi8((char)len),
+			_mm256_setr_epi8( 0,  1,  2,  3,  4,  5,  6,  7,
+			                  8,  9, 10, 11, 12, 13, 14, 15,
+			                 16, 17, 18, 19, 20, 21, 22, 23,
+			                 24, 25, 26, 27, 28, 29, 30, 31));
+		err = _mm256_or_si256(err, _mm256_and_si256(msk,
+			utf8_vec_check_avx2(cur, prev, lead, cont, need)));
+		ncont += (size_t)__builtin_popcount((unsigned)_mm256_movemask_epi8(
+			_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), cur)));
+	}
+
+	*carry = utf8_vec_carry(*carry, beg, num);
+	*count = num - ncont;
+	return _mm256_testz_si256(err, err);
+}
+
+/**
+ * @brief Count the bytes which are not continuation bytes.
+ *
+ * Compare results are summed in byte lanes for up to 255 blocks at a
+ * time, then folded into 64-bit sums.
+ */
+static size_t
+utf8_count_avx2 (uint8_t const *ptr,
+                 size_t         len)
+{
+	__m256i const c = _mm256_set1_epi8(-65);
+	size_t n = 0;
+
+	while (len >= 32U) {
+		__m256i acc = _mm256_setzero_si256();
+		for (unsigned i = 0; i < 255U && len >= 32U; ++i) {
+			__m256i cur = _mm256_loadu_si256((__m256i const *)ptr);
+			acc = _mm256_sub_epi8(acc, _mm256_cmpgt_epi8(cur, c));
+			ptr += 32;
+			len -= 32U;
+		}
+		uint64_t sum[4];
+		_mm256_storeu_si256((__m256i *)sum,
+		                    _mm256_sad_epu8(acc, _mm256_setzero_si256()));
+		n += (size_t)(sum[0] + sum[1] + sum[2] + sum[3]);
+	}
+
+	return n + utf8_count_leading(ptr, ptr + len);
+}
+utf8_target_pop()
+
+utf8_target_push("avx512f,avx512bw,avx512vbmi")
+
+/**
+ * @brief Validate one 64-byte block, given the block before it.
+ *
+ * @return A mask with bits set where errors were found.
+ */
+utf8_force_inline __mmask64
+utf8_vec_check_avx512 (__m512i const  cur,
+                       __m512i const  prev,
+                       __m512i const  lead,
+                       __m512i const  cont,
+                       __m512i const *need)
+{
+	__m512i p0 = _mm512_alignr_epi64(cur, prev, 6);
+	__m512i p1 = _mm512_alignr_epi8(cur, p0, 15);
+	__m512i p2 = _mm512_alignr_epi8(cur, p0, 14);
+	__m512i p3 = _mm512_alignr_epi8(cur, p0, 13);
+
+	__mmask64 is_lead = _mm512_cmpgt_epu8_mask(p1, need[0]);
+	__m512i hi = _mm512_and_si512(_mm512_srli_epi16(cur, 4),
+	                              _mm512_set1_epi8(0x0f));
+	__mmask64 e = _mm512_test_epi8_mask(
+		_mm512_maskz_permutexvar_epi8(is_lead, p1, lead),
+		_mm512_shuffle_epi8(cont, hi));
+
+	__mmask64 must = is_lead
+	               | _mm512_cmpgt_epu8_mask(p2, need[1])
+	               | _mm512_cmpgt_epu8_mask(p3, need[2]);
+
+	__mmask64 is_cont = _mm512_cmplt_epi8_mask(cur, _mm512_set1_epi8(-64));
+
+	return e | (must ^ is_cont);
+}
+
+static bool
+utf8_validate_avx512 (struct utf8_vec_lut const *const v,
+                      uint8_t const                   *ptr,
+                      size_t                           len,
+                      uint32_t                  *const carry,
+                      size_t                    *const count)
+{
+	__m512i const lead = _mm512_loadu_si512(v->lead);
+	__m512i const cont = _mm512_broadcast_i32x4(
+		_mm_loadu_si128((__m128i const *)v->cont));
+	__m512i const need[3] = {
+		_mm512_set1_epi8((char)v->need[0]),
+		_mm512_set1_epi8((char)v->need[1]),
+		_mm512_set1_epi8((char)v->need[2]),
+	};
+	__m512i tail = _mm512_set1_epi8(-1);
+	tail = _mm512_mask_set1_epi8(tail, 1ULL << 61U, (char)v->need[2]);
+	tail = _mm512_mask_set1_epi8(tail, 1ULL << 62U, (char)v->need[1]);
+	tail = _mm512_mask_set1_epi8(tail, 1ULL << 63U, (char)v->need[0]);
+
+	uint8_t const *const beg = ptr;
+	size_t const         num = len;
+	__m512i prev = _mm512_inserti32x4(_mm512_setzero_si512(),
+		_mm_slli_si128(_mm_cvtsi32_si128((int)*carry), 13), 3);
+	__mmask64 err = 0;
+	size_t ncont = 0;
+
+	for (; len >= 64U; ptr += 64, len -= 64U) {
+		__m512i cur = _mm512_loadu_si512(ptr);
+		if (_mm512_movepi8_mask(cur)) {
+			err |= utf8_vec_check_avx512(cur, prev, lead, cont, need);
+			ncont += (size_t)__builtin_popcountll(_mm512_cmplt_epi8_mask(
+				cur, _mm512_set1_epi8(-64)));
+		} else
+			err |= _mm512_test_epi8_mask(_mm512_subs_epu8(prev, tail),
+			                             _mm512_set1_epi8(-1));
+		prev = cur;
+	}
+
+	if (len) {
+		__mmask64 msk = (1ULL << len) - 1U;
+		__m512i cur = _mm512_maskz_loadu_epi8(msk, ptr);
+		err |= msk & utf8_vec_check_avx512(cur, prev, lead, cont, need);
+		ncont += (size_t)__builtin_popcountll(_mm512_cmplt_epi8_mask(
+			cur, _mm512_set1_epi8(-64)));
+	}
+
+	*carry = utf8_vec_carry(*carry, beg, num);
+	*count = num - ncont;
+	return !err;
+}
+
+/**
+ * @brief Count the bytes which are not continuation bytes.
+ */
+static size_t
+utf8_count_avx512 (uint8_t const *ptr,
+                   size_t         len)
+{
+	__m512i const c = _mm512_set1_epi8(-65);
+	size_t n = 0;
+
+	for (; len >= 64U; ptr += 64, len -= 64U)
+		n += (size_t)__builtin_popcountll(_mm512_cmpgt_epi8_mask(
+			_mm512_loadu_si512(ptr), c));
+
+	if (len) {
+		__mmask64 msk = (1ULL << len) - 1U;
+		n += (size_t)__builtin_popcountll(_mm512_mask_cmpgt_epi8_mask(
+			msk, _mm512_maskz_loadu_epi8(msk, ptr), c));
+	}
+
+	return n;
+}
+utf8_target_pop()
+
+/**
+ * @brief Vector kernels by instruction set level.
+ */
+static bool (*const utf8_vec_fn[])(struct utf8_vec_lut const *,
+                                   uint8_t const *, size_t, uint32_t *,
+                                   size_t *) = {
+	[utf8_isa_scalar] = nullptr,
+	[utf8_isa_sse42 ] = utf8_validate_sse42,
+	[utf8_isa_avx2  ] = utf8_validate_avx2,
+	[utf8_isa_avx512] = utf8_validate_avx512,
+};
+
+/**
+ * @brief Code point counting kernels by instruction set level.
+ */
+static size_t (*const utf8_vec_count_fn[])(uint8_t const *, size_t) = {
+	[utf8_isa_scalar] = nullptr,
+	[utf8_isa_sse42 ] = utf8_count_sse42,
+	[utf8_isa_avx2  ] = utf8_count_avx2,
+	[utf8_isa_avx512] = utf8_count_avx512,
+};
+
+/**
+ * @brief Derive @ref utf8_vec from the scalar state machine.
+ */
+static void
+utf8_vec_init (void)
+{
+	constexpr static const uint8_t utf8_len[16] = {
+		//! @cond
+		#define F(n,m,l,...) [n] = l,
+		//! @endcond
+		UTF8_PARSER_DESCRIPTOR(F)
+		//! @cond
+		#undef F
+		//! @endcond
+	};
+
+	struct utf8_vec_lut v = {
+		.need = {0xbfU, 0xffU, 0xffU},
+	};
+
+	// Counting doesn't depend on the tables below
+	utf8_vec_count = utf8_vec_count_fn[utf8_cpu_isa()];
+
+	uint16_t const lead = utf8_dst[utf8_ini];
+	uint16_t const cont = (uint16_t)~(lead | utf8_bit(ini));
+
+	// Byte classes must fall on the boundaries the kernels assume
+	for (unsigned b = 0; b < 256U; ++b) {
+		uint16_t bits = utf8_lut[b];
+		if (b < 0x80U ? bits != utf8_bit(asc)
+		    : b < 0xc0U ? !bits || (bits & ~cont)
+		    : (bits & ~(lead & ~utf8_bit(asc))))
+			return;
+	}
+
+	for (unsigned h = 0x8U; h < 0xcU; ++h)
+		v.cont[h] = (uint8_t)(1U << (h - 0x8U));
+
+	for (unsigned b = 0xc0U; b < 256U; ++b) {
+		uint16_t bits = utf8_lut[b];
+		if (!bits) {
+			// Invalid leading byte, reject any continuation
+			v.lead[b - 0xc0U] = 0x0fU;
+			continue;
+		}
+
+		if (bits & (bits - 1U))
+			return;
+
+		unsigned st8 = (unsigned)__builtin_ctz(bits);
+		unsigned len = utf8_len[st8];
+		if (len < 2U || len > 4U)
+			return;
+
+		// Only the first continuation may have a restricted range
+		uint8_t mask = 0;
+		uint16_t next = utf8_dst[st8];
+		for (unsigned i = 1; i < len; ++i) {
+			if (!next || (next & (next - 1U)) || (next & ~cont))
+				return;
+			for (unsigned c = 0x80U; c < 0xc0U; ++c) {
+				if (utf8_lut[c] & next)
+					continue;
+				if (i > 1U)
+					return;
+				mask |= v.cont[c >> 4U];
+			}
+			next = utf8_dst[__builtin_ctz(next)];
+		}
+
+		if (next != lead)
+			return;
+
+		// Restricted ranges must be whole high nibbles
+		for (unsigned c = 0x80U; c < 0xc0U; ++c) {
+			if ((mask & v.cont[c >> 4U]) &&
+			    (utf8_lut[c] & utf8_dst[st8]))
+				return;
+		}
+
+		v.lead[b - 0xc0U] = mask;
+		if (len > 2U && b <= v.need[len - 2U])
+			v.need[len - 2U] = (uint8_t)(b - 1U);
+	}
+
+	// Sequence length must be monotonic in the leading byte value
+	for (unsigned b = 0xc0U; b < 256U; ++b) {
+		uint16_t bits = utf8_lut[b];
+		if (!bits)
+			continue;
+		unsigned len = utf8_len[__builtin_ctz(bits)];
+		if ((b > v.need[1]) != (len > 2U) ||
+		    (b > v.need[2]) != (len > 3U))
+			return;
+	}
+
+	v.fn = utf8_vec_fn[utf8_cpu_isa()];
+	utf8_vec = v;
+}
+
+utf8_nonnull_out
+struct utf8_vec_lut const *
+utf8_vec_get (void)
+{
+	call_once(&utf8_vec_once, utf8_vec_init);
+	return &utf8_vec;
+}
+#endif /* UTF8_SIMD */
+
+/**
+ * @brief Validate a buffer by walking the state transition tables.
+ */
+static bool
+utf8_validate_scalar (uint8_t const *ptr,
+                      size_t         len)
+{
+	uint16_t const lead = utf8_dst[utf8_ini];
+	uint16_t next = lead;
+
+	for (uint8_t const *const end = ptr + len; ptr < end; ++ptr) {
+		if (next == lead) {
+			ptr += utf8_ascii_run(ptr, end);
+			if (ptr == end)
+				break;
+		}
+		uint16_t bit = utf8_lut[*ptr] & next;
+		if (!bit)
+			return false;
+		next = utf8_dst[__builtin_ctz(bit)];
+	}
+
+	return next == lead;
+}
+
+bool
+utf8_validate (uint8_t const *ptr,
+               size_t         len)
+{
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+	if (utf8_vec.fn) {
+		uint32_t carry = 0;
+		size_t count;
+		return utf8_vec.fn(&utf8_vec, ptr, len, &carry, &count)
+		    && utf8_vec_done(&utf8_vec, carry);
+	}
+#endif /* UTF8_SIMD */
+
+	return utf8_validate_scalar(ptr, len);
+}
+
+utf8_nonnull_in
+bool
+utf8_stream_feed (struct utf8 *const  u8p,
+                  uint8_t const      *ptr,
+                  size_t              len)
+{
+	if (u8p->error)
+		return false;
+
+	uint8_t const *const end = ptr + len;
+
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+	if (utf8_vec.fn) {
+		// Finish a sequence split off from the previous chunk
+		while (ptr < end && !utf8_expects_leading_byte(u8p)) {
+			ptr = utf8_parse_span(u8p, ptr, ptr + 1).ptr;
+			if (u8p->error)
+				return false;
+		}
+
+		uint32_t carry = 0;
+		size_t count;
+		if (!utf8_vec.fn(&utf8_vec, ptr, (size_t)(end - ptr), &carry,
+		                 &count)) {
+			u8p->error = EILSEQ;
+			return false;
+		}
+
+		if (utf8_vec_done(&utf8_vec, carry))
+			return true;
+
+		// Park the incomplete sequence at the end in the parser
+		uint8_t const *q = end - 1;
+		while (q > ptr && utf8_vec.cont[*q >> 4U])
+			--q;
+
+		utf8_reset(u8p);
+		(void)utf8_parse_span(u8p, q, end);
+		return !u8p->error;
+	}
+#endif /* UTF8_SIMD */
+
+	(void)utf8_parse_span(u8p, ptr, end);
+	return !u8p->error;
+}
+
+utf8_nonnull_in
+bool
+utf8_stream_finish (struct utf8 *const u8p)
+{
+	if (!u8p->error && !utf8_expects_leading_byte(u8p))
+		u8p->error = EILSEQ;
+
+	return !u8p->error;
+}
+
+utf8_nonnull_in
+size_t
+utf8_count_code_points (uint8_t const *ptr,
+                        size_t         len)
+{
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+	if (utf8_vec_count)
+		return utf8_vec_count(ptr, len);
+#endif /* UTF8_SIMD */
+
+	return utf8_count_leading(ptr, ptr + len);
+}
+
+utf8_nonnull_in
+struct utf8_span
+utf8_validate_count (struct utf8 *const  u8p,
+                     uint8_t const      *ptr,
+                     size_t              len)
+{
+	uint8_t const *const end = ptr + len;
+	size_t count = 0;
+
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+	if (utf8_vec.fn) {
+		// Finish a sequence split off from the previous span
+		while (ptr < end && !utf8_expects_leading_byte(u8p)) {
+			struct utf8_span s = utf8_parse_span(u8p, ptr, ptr + 1);
+			count += s.count;
+			ptr = s.ptr;
+			if (u8p->error)
+				return (struct utf8_span){ptr, count};
+		}
+
+		// Validate and count in blocks, so that an error costs at
+		// most one block of rework however far into the span it is.
+		// Blocks start small and grow, keeping that rework in line
+		// with the distance to the error when errors are frequent.
+		uint32_t carry = 0;
+		uint8_t const *blk = ptr;
+		for (size_t max = 64U; blk < end;) {
+			size_t n = (size_t)(end - blk), k;
+			if (n > max)
+				n = max;
+			if (!utf8_vec.fn(&utf8_vec, blk, n, &carry, &k))
+				break;
+			count += k;
+			blk += n;
+			if (max < utf8_vec_block)
+				max <<= 1U;
+		}
+
+		// Parse the rest with the scalar path, starting two code
+		// points back: the kernels only flag a bad leading byte at
+		// the byte after it, and the parser state must end up the
+		// same as with the scalar path even if the error is there.
+		for (int i = 0; i < 2 && blk > ptr; ++i) {
+			do --blk;
+			while (blk > ptr && utf8_vec.cont[*blk >> 4U]);
+			--count;
+		}
+		ptr = blk;
+	}
+#endif /* UTF8_SIMD */
+
+	struct utf8_span s = utf8_parse_span(u8p, ptr, end);
+	s.count += count;
+	return s;
+}
+
+/**
+ * @brief Find and classify the first invalid sequence in `[ptr, end)`,
+ *        which must start at a sequence boundary.
+ *
+ * The error class follows from the byte the state machine rejects and
+ * the state it rejects it in.
+ */
+static struct utf8_check
+utf8_check_scalar (uint8_t const *const beg,
+                   uint8_t const       *ptr,
+                   uint8_t const *const end)
+{
+	uint16_t const lead = utf8_dst[utf8_ini];
+	uint16_t next = lead;
+	unsigned st8 = utf8_ini;
+	uint8_t const *seq = ptr;
+
+	for (; ptr < end; ++ptr) {
+		if (next == lead) {
+			ptr += utf8_ascii_run(ptr, end);
+			if (ptr == end)
+				break;
+			seq = ptr;
+		}
+
+		uint16_t bit = utf8_lut[*ptr] & next;
+		if (bit) {
+			st8 = (unsigned)__builtin_ctz(bit);
+			next = utf8_dst[st8];
+			continue;
+		}
+
+		enum utf8_error_class error;
+		if (ptr == seq)
+			error = *ptr < 0xc0U ? utf8_stray_continuation
+			      : *ptr < 0xc2U ? utf8_overlong
+			      :                utf8_too_large;
+		else if ((*ptr & 0xc0U) != 0x80U)
+			error = utf8_missing_continuation;
+		else // Only the restricted leading bytes reject these
+			error = st8 == utf8_lb3_ed ? utf8_surrogate
+			      : st8 == utf8_lb4_f4 ? utf8_too_large
+			      :                      utf8_overlong;
+
+		return (struct utf8_check) {
+			.offset = (size_t)(seq - beg),
+			.error  = error,
+		};
+	}
+
+	return next == lead ? (struct utf8_check) {
+		.offset = (size_t)(end - beg),
+		.error  = utf8_valid,
+	} : (struct utf8_check) {
+		.offset = (size_t)(seq - beg),
+		.error  = utf8_truncated,
+	};
+}
+
+#ifdef UTF8_SIMD
+/** Most input checked per kernel call by utf8_check(). Large enough
+ *  to hide the cost of a call, small enough to be rescanned quickly. */
+constexpr static const size_t utf8_check_block = (size_t)1U << 14U;
+#endif /* UTF8_SIMD */
+
+utf8_nonnull_in
+struct utf8_check
+utf8_check (uint8_t const *ptr,
+            size_t         len)
+{
+	uint8_t const *const end = ptr + len;
+	uint8_t const *blk = ptr;
+
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+	if (utf8_vec.fn && len) {
+		uint32_t carry = 0;
+		size_t n, count;
+
+		// Only the block with the first error in it is looked at
+		// again; until then this costs what utf8_validate() does
+		for (;; blk += n) {
+			n = (size_t)(end - blk);
+			if (n > utf8_check_block)
+				n = utf8_check_block;
+			if (!utf8_vec.fn(&utf8_vec, blk, n, &carry, &count))
+				break;
+			if (n == (size_t)(end - blk)) {
+				if (utf8_vec_done(&utf8_vec, carry))
+					return (struct utf8_check) {
+						.offset = len,
+						.error  = utf8_valid,
+					};
+				break;
+			}
+		}
+
+		// Back up to the start of a sequence which the block
+		// begins in the middle of
+		for (unsigned k = 1U; k <= 3U && k <= (size_t)(blk - ptr); ++k) {
+			uint8_t b = *(blk - k);
+			if (!utf8_vec.cont[b >> 4U]) {
+				if (b > utf8_vec.need[k - 1U])
+					blk -= k;
+				break;
+			}
+		}
+	}
+#endif /* UTF8_SIMD */
+
+	return utf8_check_scalar(ptr, blk, end);
+}
+
+#ifdef UTF8_SIMD
+/** Longest string packed with others by utf8_validate_batch(). */
+constexpr static const size_t utf8_batch_max = 256U;
+
+/** Strings checked together in an invalid utf8_validate_batch() block. */
+constexpr static const size_t utf8_batch_group = 8U;
+#endif /* UTF8_SIMD */
+
+utf8_nonnull_in
+size_t
+utf8_validate_batch (uint8_t const *const  ptrs[],
+                     size_t const          lens[],
+                     size_t                n,
+                     struct utf8_check     results[])
+{
+	size_t valid = 0;
+	size_t i = 0;
+
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+	if (utf8_vec.fn) {
+		uint8_t buf[utf8_vec_block];
+
+		while (i < n) {
+			// Pack short strings into one block, each followed
+			// by a null byte. A sequence cut short by the end of
+			// a string is then invalid in the block too, and so
+			// is a continuation byte at the start of the next.
+			size_t j = i, len = 0;
+			for (; j < n && lens[j] <= utf8_batch_max
+			       && len + lens[j] < sizeof buf; ++j) {
+				__builtin_memcpy(&buf[len], ptrs[j], lens[j]);
+				len += lens[j];
+				buf[len++] = 0;
+			}
+
+			if (j == i) {
+				results[i] = utf8_check(ptrs[i], lens[i]);
+				valid += results[i].error == utf8_valid;
+				++i;
+				continue;
+			}
+
+			// Narrow an invalid block down to groups of strings
+			// before checking them one by one. Every block and
+			// group ends in ASCII, so the carry needs no check.
+			for (size_t g = j - i, beg = 0; i < j; g = utf8_batch_group) {
+				size_t k = i, end = beg;
+				for (; k < j && k - i < g; ++k)
+					end += lens[k] + 1U;
+
+				uint32_t carry = 0;
+				size_t count;
+				bool ok = utf8_vec.fn(&utf8_vec, &buf[beg],
+				                      end - beg, &carry, &count);
+				if (!ok && g > utf8_batch_group)
+					continue;
+
+				for (; i < k; ++i) {
+					results[i] = ok ? (struct utf8_check) {
+						.offset = lens[i],
+						.error  = utf8_valid,
+					} : utf8_check(ptrs[i], lens[i]);
+					valid += results[i].error == utf8_valid;
+				}
+
+				beg = end;
+			}
+		}
+	}
+#endif /* UTF8_SIMD */
+
+	for (; i < n; ++i) {
+		results[i] = utf8_check(ptrs[i], lens[i]);
+		valid += results[i].error == utf8_valid;
+	}
+
+	return valid;
+}
+
+/** Smallest segment worth handing to a thread of its own. */
+constexpr static const size_t utf8_mt_segment_min = (size_t)1U << 20U;
+
+/**
+ * @brief A segment of a buffer validated by @ref utf8_validate_mt().
+ */
+struct utf8_mt_segment {
+	struct utf8       u8p;  //!< Parser state at the end of the segment.
+	struct utf8_span  span; //!< Result of parsing the segment.
+	uint8_t const    *beg;  //!< First byte of the segment.
+	uint8_t const    *end;  //!< One past the last byte of the segment.
+};
+
+static int
+utf8_mt_worker (void *arg)
+{
+	struct utf8_mt_segment *const seg = arg;
+	seg->span = utf8_validate_count(&seg->u8p, seg->beg,
+	                                (size_t)(seg->end - seg->beg));
+	return 0;
+}
+
+/**
+ * @brief Get the number of online processors, or 1 if unknown.
+ */
+static unsigned
+utf8_mt_cpus (void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n > 0)
+		return n < (long)UINT_MAX ? (unsigned)n : UINT_MAX;
+#endif /* _SC_NPROCESSORS_ONLN */
+	return 1U;
+}
+
+utf8_nonnull_in
+struct utf8_span
+utf8_validate_mt (struct utf8   *const u8p,
+                  uint8_t const *const ptr,
+                  size_t               len,
+                  unsigned             nthreads)
+{
+#ifdef UTF8_SIMD
+	call_once(&utf8_vec_once, utf8_vec_init);
+#endif /* UTF8_SIMD */
+
+	uint8_t const *const end = ptr + len;
+
+	if (!nthreads)
+		nthreads = utf8_mt_cpus();
+	if (nthreads > len / utf8_mt_segment_min)
+		nthreads = (unsigned)(len / utf8_mt_segment_min);
+
+	struct utf8_mt_segment *seg = nthreads > 1U
+	                            ? calloc(nthreads, sizeof *seg)
+	                            : nullptr;
+	if (!seg)
+		return utf8_validate_count(u8p, ptr, len);
+
+	// Move every split point forward to the next byte which is not a
+	// continuation byte. Valid UTF-8 can't have a sequence crossing
+	// such a split point, so each segment can be parsed from scratch.
+	seg[0].u8p = *u8p;
+	seg[0].beg = ptr;
+	for (unsigned i = 1U; i < nthreads; ++i) {
+		uint8_t const *p = ptr + (size_t)((uint64_t)len * i / nthreads);
+		if (p < seg[i - 1U].beg)
+			p = seg[i - 1U].beg;
+		while (p < end && (*p & 0xc0U) == 0x80U)
+			++p;
+
+		seg[i].u8p = utf8();
+		seg[i].beg = p;
+		seg[i - 1U].end = p;
+	}
+	seg[nthreads - 1U].end = end;
+
+	thrd_t *thr = calloc(nthreads, sizeof *thr);
+	bool *run = calloc(nthreads, sizeof *run);
+	for (unsigned i = 1U; thr && run && i < nthreads; ++i)
+		run[i] = thrd_create(&thr[i], utf8_mt_worker, &seg[i])
+		         == thrd_success;
+
+	for (unsigned i = 0; i < nthreads; ++i) {
+		if (!i || !run || !run[i])
+			(void)utf8_mt_worker(&seg[i]);
+	}
+
+	for (unsigned i = 1U; run && i < nthreads; ++i) {
+		if (run[i])
+			(void)thrd_join(thr[i], nullptr);
+	}
+
+	free(run);
+	free(thr);
+
+	// Stitch the segments together. A segment can be taken as is
+	// if the serial parser would have entered it on a code point
+	// boundary, and if it consumed a code point before stopping
+	// (otherwise its parser state still differs from the serial
+	// one). At the first seam that fails this the remaining input
+	// is handed to the scalar parser, which stops within a couple
+	// of bytes: the segment begins with a byte that either can't
+	// continue the previous sequence or starts an invalid one.
+	struct utf8 st = *u8p;
+	struct utf8_span ret = {end, 0};
+
+	for (unsigned i = 0; i < nthreads; ++i) {
+		struct utf8_mt_segment const *const s = &seg[i];
+		if (s->beg == s->end)
+			continue;
+
+		if (i && (!utf8_expects_leading_byte(&st)
+		          || (!s->span.count
+		              && (s->u8p.error
+		                  || !utf8_expects_leading_byte(&s->u8p))))) {
+			struct utf8_span r = utf8_parse_span(&st, s->beg, end);
+			ret.ptr = r.ptr;
+			ret.count += r.count;
+			break;
+		}
+
+		st = s->u8p;
+		ret.count += s->span.count;
+		if (st.error) {
+			ret.ptr = s->span.ptr;
+			break;
+		}
+	}
+
+	free(seg);
+	*u8p = st;
+	return ret;
+}
+
+#endif /* !__cplusplus */
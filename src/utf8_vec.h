@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_vec.h
+ * @brief Vector validation kernel tables shared by the bulk APIs.
+ * @author Juuso Alasuutari
+ */
+#ifndef CUTF8_SRC_UTF8_VEC_H_
+#define CUTF8_SRC_UTF8_VEC_H_
+
+#include "utf8_impl.h"
+
+#ifdef UTF8_SIMD
+/**
+ * @brief Lookup tables for the vector validation kernels.
+ *
+ * The vector kernels check every byte against the byte before it
+ * (first continuation ranges) and against the three bytes before
+ * it (sequence structure). The tables describing those checks are
+ * not written by hand; they are derived from @ref utf8_lut and
+ * @ref utf8_dst, and the vector kernels are not enabled if the
+ * state machine ever stops fitting that model.
+ */
+struct utf8_vec_lut {
+	/** Continuation classes rejected after leading byte 0xc0+i. */
+	uint8_t lead[64];
+	/** Continuation class bit of a byte, indexed by high nibble. */
+	uint8_t cont[16];
+	/** Largest byte value not needing a 1st, 2nd, 3rd continuation. */
+	uint8_t need[3];
+	/**
+	 * @brief The selected kernel, or `nullptr` if none is usable.
+	 *
+	 * Validates `len` bytes at `ptr` as the continuation of the
+	 * input whose last three bytes are in `*carry`, and updates
+	 * `*carry`. Stores the number of bytes which are not
+	 * continuation bytes in `*count`. A sequence cut short by
+	 * the end of the input is not an error; check for that with
+	 * @ref utf8_vec_done().
+	 *
+	 * @return `true` if no invalid bytes were found.
+	 */
+	bool  (*fn)(struct utf8_vec_lut const *v,
+	            uint8_t const *ptr, size_t len,
+	            uint32_t *carry, size_t *count);
+};
+
+/** Most input checked per kernel call by the block-wise bulk APIs. */
+constexpr static const size_t utf8_vec_block = (size_t)1U << 12U;
+
+/**
+ * @brief Check that the last bytes of the input don't end
+ *        in the middle of a multi-byte sequence.
+ *
+ * @param v The vector kernel lookup tables.
+ * @param carry The last three input bytes, the newest one in
+ *              bits 16-23.
+ * @return `true` if no continuation bytes are pending.
+ */
+utf8_nonnull_in
+utf8_force_inline bool
+utf8_vec_done (struct utf8_vec_lut const *const v,
+               uint32_t                         carry)
+{
+	return (uint8_t)(carry >> 16U) <= v->need[0]
+	    && (uint8_t)(carry >>  8U) <= v->need[1]
+	    && (uint8_t)(carry       ) <= v->need[2];
+}
+
+/**
+ * @brief Get the vector kernel tables, initializing them on first use.
+ *
+ * @return The tables. Their kernel pointer is `nullptr` if the vector
+ *         kernels can't be used.
+ */
+utf8_nonnull_out
+extern struct utf8_vec_lut const *
+utf8_vec_get (void);
+#endif /* UTF8_SIMD */
+
+#endif /* CUTF8_SRC_UTF8_VEC_H_ */
@@ -0,0 +1,101 @@
+/* SPDX-License-Identifier: LGPL-3.0-or-later */
+/** @file utf8_width.c
+ *
+ * @author Juuso Alasuutari
+ */
+#ifndef __cplusplus
+
+#include <errno.h>
+
+#include "utf8_impl.h"
+#include "utf8_width_lut.h"
+
+/**
+ * @brief Look up the display width of a code point.
+ *
+ * @param cp A Unicode scalar value.
+ * @return 0, 1 or 2 columns.
+ */
+utf8_const_inline unsigned
+utf8_width_of (uint32_t cp)
+{
+	uint8_t const *blk = utf8_width_blk[utf8_width_idx[cp >> 8U]];
+	return (unsigned)(blk[(cp & 0xffU) >> 2U] >> ((cp & 3U) << 1U)) & 3U;
+}
+
+/**
+ * @brief Measure a run of printable ASCII, which is one column wide
+ *        per byte.
+ *
+ * @return The number of bytes before the first byte which is not in
+ *         the range 0x20-0x7e, or before `end`.
+ */
+utf8_nonnull_in
+utf8_force_inline size_t
+utf8_print_run (uint8_t const *const ptr,
+                uint8_t const *const end)
+{
+	uint8_t const *p = ptr;
+
+#if defined __SSE2__ && !defined UTF8_NO_SIMD
+	__m128i const sp = _mm_set1_epi8(0x1f);
+	__m128i const del = _mm_set1_epi8(0x7f);
+
+	for (; end - p >= 16; p += 16) {
+		// The signed compare also fails bytes 0x80-0xff
+		__m128i v = _mm_loadu_si128((__m128i const *)p);
+		__m128i ok = _mm_andnot_si128(_mm_cmpeq_epi8(v, del),
+		                              _mm_cmpgt_epi8(v, sp));
+		unsigned m = ~(unsigned)_mm_movemask_epi8(ok) & 0xffffU;
+		if (m)
+			return (size_t)(p - ptr) + (unsigned)__builtin_ctz(m);
+	}
+#endif /* __SSE2__ && !UTF8_NO_SIMD */
+
+	while (p < end && (unsigned)*p - 0x20U < 0x5fU)
+		++p;
+
+	return (size_t)(p - ptr);
+}
+
+utf8_nonnull_in
+struct utf8_width
+utf8_display_width (uint8_t const *const ptr,
+                    size_t               len)
+{
+	uint8_t const *p = ptr;
+	uint8_t const *const end = ptr + len;
+	size_t width = 0;
+	int error = 0;
+
+	while (p < end) {
+		size_t n = utf8_print_run(p, end);
+		p += n;
+		width += n;
+		if (p == end)
+			break;
+
+		// Control characters take no columns
+		if (*p < 0x80U) {
+			++p;
+			continue;
+		}
+
+		struct utf8_decoded d = utf8_decode_next(p, end);
+		if (d.status != utf8_decode_ok) {
+			error = EILSEQ;
+			break;
+		}
+
+		width += utf8_width_of(d.code_point);
+		p += d.len;
+	}
+
+	return (struct utf8_width) {
+		.width  = width,
+		.offset = (size_t)(p - ptr),
+		.error  = error,
+	};
+}
+
+#endif /* !__cplusplus */